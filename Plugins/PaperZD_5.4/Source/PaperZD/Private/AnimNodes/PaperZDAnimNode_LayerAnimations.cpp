@@ -35,7 +35,7 @@ void FPaperZDAnimNode_LayerAnimations::OnEvaluate(FPaperZDAnimationPlaybackData&
 	for (int32 i = 0; i < AnimationLayer.Num(); i++)
 	{
 		FPaperZDAnimDataLink& Anim = AnimationLayer[i];
-		FPaperZDAnimationPlaybackData LayerData;
+		LayerData.Reset();
 		Anim.Evaluate(LayerData);
 
 		//If this is the base layer, copy the data from there
@@ -45,14 +45,12 @@ void FPaperZDAnimNode_LayerAnimations::OnEvaluate(FPaperZDAnimationPlaybackData&
 		}
 
 		//Add the layer data
-		OutData.WeightedAnimations.Reserve(LayerData.WeightedAnimations.Num());
+		OutData.WeightedAnimations.Reserve(OutData.WeightedAnimations.Num() + LayerData.WeightedAnimations.Num());
 		for (const FPaperZDWeightedAnimation& WeightedAnim : LayerData.WeightedAnimations)
 		{
-			FPaperZDWeightedAnimation LayeredAnim = WeightedAnim;
+			FPaperZDWeightedAnimation& LayeredAnim = OutData.WeightedAnimations.Add_GetRef(WeightedAnim);
 			LayeredAnim.Layer = i;
 			LayeredAnim.LayerWeight = LayerWeight[i];
-
-			OutData.WeightedAnimations.Add(LayeredAnim);
 		}
 	}
 }
@@ -8,6 +8,8 @@
 #endif
 
 FPaperZDAnimNode_OverrideSlot::FPaperZDAnimNode_OverrideSlot()
+	: SlotIndex(INDEX_NONE)
+	, bOverride(false)
 {
 	SlotName = TEXT("DefaultSlot");
 	GroupName = TEXT("DefaultGroup");
@@ -16,15 +18,18 @@ FPaperZDAnimNode_OverrideSlot::FPaperZDAnimNode_OverrideSlot()
 void FPaperZDAnimNode_OverrideSlot::OnInitialize(const FPaperZDAnimationInitContext& InitContext)
 {
 	bOverride = false;
+	SlotIndex = InitContext.AnimInstance->GetOverrideSlotIndex(SlotName);
 	Animation.Initialize(InitContext);
 }
 
 void FPaperZDAnimNode_OverrideSlot::OnUpdate(const FPaperZDAnimationUpdateContext& UpdateContext)
 {
 	//If there's an override, we need to make sure the weight of this update call is zero, to avoid any unwanted notify from triggering.
-	bOverride = UpdateContext.AnimInstance->GetAnimationOverrideDataBySlot(SlotName, OverrideData);
+	const FPaperZDAnimationPlaybackData* pOverrideData = UpdateContext.AnimInstance->GetAnimationOverrideDataBySlotIndex(SlotIndex);
+	bOverride = pOverrideData != nullptr;
 	if (bOverride)
 	{
+		OverrideData = *pOverrideData;
 		Animation.Update(UpdateContext.FractionalWeight(0.0f));
 	}
 	else
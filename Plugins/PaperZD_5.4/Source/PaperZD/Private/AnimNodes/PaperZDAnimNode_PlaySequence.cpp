@@ -21,7 +21,7 @@ void FPaperZDAnimNode_PlaySequence::OnInitialize(const FPaperZDAnimationInitCont
 	if (AnimSequence)
 	{
 		//Initialize the starting time
-		const float SeqDuration = AnimSequence->GetTotalDuration();
+		const float SeqDuration = AnimSequence->GetPlaybackDuration();
 		PlaybackTime = PlayRate < 0.0f ? SeqDuration : FMath::Min(StartPosition, SeqDuration);
 	}
 }
@@ -132,6 +132,6 @@ void FPaperZDAnimNode_RandomPlayer::PickNextEntry()
 	}
 	
 	//Initialize the starting time
-	const float SeqDuration = Entry.AnimSequence->GetTotalDuration();
+	const float SeqDuration = Entry.AnimSequence->GetPlaybackDuration();
 	PlaybackTime = PlayRate < 0.0f ? SeqDuration : 0.0f;
 }
@@ -1,6 +1,7 @@
 // Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
 
 #include "AnimNodes/PaperZDAnimNode_SetDirectionality.h"
+#include "PaperZDAnimInstance.h"
 
 #if ZD_VERSION_INLINED_CPP_SUPPORT
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDAnimNode_SetDirectionality)
@@ -8,6 +9,7 @@
 
 FPaperZDAnimNode_SetDirectionality::FPaperZDAnimNode_SetDirectionality()
 	: Input(FVector2D::ZeroVector)
+	, bUseResolvedDirection(false)
 	, CachedDirectionalAngle(0.0f)
 {}
 
@@ -18,11 +20,18 @@ void FPaperZDAnimNode_SetDirectionality::OnInitialize(const FPaperZDAnimationIni
 
 void FPaperZDAnimNode_SetDirectionality::OnUpdate(const FPaperZDAnimationUpdateContext& UpdateContext)
 {
-	//Cache the directional angle
-	static const FVector2D TopPosition(0.0f, 1.0f);
-	const float Sign = Input.X != 0.0f ? FMath::Sign(Input.X) : 1.0f;
-	const float AngleRad = FMath::Acos(Input.GetSafeNormal() | TopPosition) * Sign;
-	CachedDirectionalAngle = FMath::RadiansToDegrees(AngleRad);
+	//Cache the directional angle, the batched direction is the last one resolved by the directionality subsystem
+	if (bUseResolvedDirection && UpdateContext.AnimInstance->IsResolvingDirectionInBatch())
+	{
+		CachedDirectionalAngle = UpdateContext.AnimInstance->GetResolvedDirectionalAngle();
+	}
+	else
+	{
+		static const FVector2D TopPosition(0.0f, 1.0f);
+		const float Sign = Input.X != 0.0f ? FMath::Sign(Input.X) : 1.0f;
+		const float AngleRad = FMath::Acos(Input.GetSafeNormal() | TopPosition) * Sign;
+		CachedDirectionalAngle = FMath::RadiansToDegrees(AngleRad);
+	}
 
 	//Update the relevant animation
 	Animation.Update(UpdateContext);
@@ -16,12 +16,15 @@ FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::FScopedAnimationUpdate(FP
 	, UpdateContext(InUpdateContext)
 {
 	check(InStateMachine);
-	SequenceCompleteHandle = UpdateContext.AnimInstance->GetPlayer()->OnPlaybackSequenceComplete_Native.AddRaw(this, &FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::OnTransitionalAnimationComplete);
+
+	//Need to delay the removal of the transitional AnimNode when its animation completes, as at that point it hasn't been evaluated.
+	//The player raises the flag for us, which avoids binding a delegate on every update.
+	UpdateContext.AnimInstance->GetPlayer()->PushSequenceCompleteFlag(&StateMachine->bPopTransitionalAnimNode);
 }
 
 FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::~FScopedAnimationUpdate()
 {
-	UpdateContext.AnimInstance->GetPlayer()->OnPlaybackSequenceComplete_Native.Remove(SequenceCompleteHandle);
+	UpdateContext.AnimInstance->GetPlayer()->PopSequenceCompleteFlag();
 }
 
 void FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::Update()
@@ -33,12 +36,6 @@ void FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::Update()
 	}
 }
 
-void FPaperZDAnimNode_StateMachine::FScopedAnimationUpdate::OnTransitionalAnimationComplete(const UPaperZDAnimSequence* AnimSequence)
-{
-	//Need to delay the removal of the transitional AnimNode, as at this point it hasn't been evaluated
-	StateMachine->bPopTransitionalAnimNode = true;
-}
-
 //////////////////////////////////////////////////////////////////////////
 //
 //////////////////////////////////////////////////////////////////////////
@@ -155,15 +152,23 @@ void FPaperZDAnimNode_StateMachine::JumpToNode(FName Name, const FPaperZDAnimati
 		const int32* pTargetNodeIdx = CachedStateMachine->JumpLinks.Find(Name);
 		if (pTargetNodeIdx)
 		{
-			SetState(*pTargetNodeIdx, Context);
-
-			//Initialize the state
-			FPaperZDAnimationInitContext InitContext(Context.AnimInstance);
-			CurrentStateAnimNode->Initialize(InitContext);
+			JumpToState(*pTargetNodeIdx, Context);
 		}
 	}
 }
 
+void FPaperZDAnimNode_StateMachine::JumpToState(int32 StateIndex, const FPaperZDAnimationBaseContext& Context)
+{
+	if (CachedStateMachine && CachedStateMachine->Nodes.IsValidIndex(StateIndex))
+	{
+		SetState(StateIndex, Context);
+
+		//Initialize the state
+		FPaperZDAnimationInitContext InitContext(Context.AnimInstance);
+		CurrentStateAnimNode->Initialize(InitContext);
+	}
+}
+
 void FPaperZDAnimNode_StateMachine::SetState(int32 NewState, const FPaperZDAnimationBaseContext& Context)
 {
 	//Call the Exit State delegate if it exists
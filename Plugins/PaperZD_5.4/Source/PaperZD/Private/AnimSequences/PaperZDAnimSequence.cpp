@@ -3,9 +3,12 @@
 #include "AnimSequences/PaperZDAnimSequence.h"
 #include "Notifies/PaperZDAnimNotify.h"
 #include "Notifies/PaperZDAnimNotifyCustom.h"
+#include "Notifies/PaperZDAnimNotifyState.h"
 #include "Components/PrimitiveComponent.h"
 #include "IPaperZDEditorProxy.h"
 #include "PaperZDCustomVersion.h"
+#include "UObject/ObjectSaveContext.h"
+#include "HAL/IConsoleManager.h"
 
 #if ZD_VERSION_INLINED_CPP_SUPPORT
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDAnimSequence)
@@ -17,6 +20,14 @@ const FName UPaperZDAnimSequence::AnimSourceMemberName(TEXT("AnimSource"));
 
 #define MAX_NUM_TRACKS 10
 
+#if WITH_EDITOR
+//Lets the cooked notify culling path be tested in editor, the baked table only gets refreshed when the sequence is edited through its properties or saved
+static TAutoConsoleVariable<bool> CVarForceBakedNotifies(
+	TEXT("PaperZD.ForceBakedNotifies"),
+	false,
+	TEXT("If true, editor builds cull sequence notifies through the baked timeline like cooked builds do."));
+#endif
+
 //List of optional metadata specifiers
 namespace FPaperZDAnimSequenceDefaults
 {
@@ -26,6 +37,11 @@ namespace FPaperZDAnimSequenceDefaults
 UPaperZDAnimSequence::UPaperZDAnimSequence(const FObjectInitializer& ObjectInitializer)
 	: Super()
 	, CachedAnimDataSourceProperty(nullptr)
+	, BakedDataSource(nullptr)
+	, BakedElementSize(0)
+	, BakedNumDirections(0)
+	, BakedAngleBias(0.0f)
+	, BakedInvAngleSeparation(0.0f)
 	, bDirectionalSequence(false)
 	, DirectionalAngleOffset(0.0f)
 	, DirectionalPreviewIndex(0)
@@ -49,6 +65,17 @@ void UPaperZDAnimSequence::PostLoad()
 		IPaperZDEditorProxy::Get()->UpdateVersionToAnimationSourceAdded(this);
 	}
 #endif
+
+	//Data source is fully loaded at this point
+	BakeDirectionalData();
+
+	//Cooked sequences come with their timeline baked, editor ones rebake it as the source data might have changed since the last save
+#if !WITH_EDITOR
+	if (!Timeline.bBaked)
+#endif
+	{
+		BakeTimeline();
+	}
 }
 
 void UPaperZDAnimSequence::Serialize(FArchive& Ar)
@@ -57,6 +84,24 @@ void UPaperZDAnimSequence::Serialize(FArchive& Ar)
 	Ar.UsingCustomVersion(FPaperZDCustomVersion::GUID);
 }
 
+#if WITH_EDITOR
+void UPaperZDAnimSequence::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+	BakeTimeline();
+
+	if (ObjectSaveContext.IsCooking())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("PaperZD: Baked timeline for '%s': %d notifies, %llu bytes"), *GetPathName(), Timeline.Notifies.Num(), (uint64)Timeline.GetAllocatedSize());
+	}
+}
+
+bool UPaperZDAnimSequence::IsBakedNotifyCullingForced()
+{
+	return CVarForceBakedNotifies.GetValueOnAnyThread();
+}
+#endif
+
 void UPaperZDAnimSequence::PostInitProperties()
 {
 	Super::PostInitProperties();
@@ -100,6 +145,13 @@ int32 UPaperZDAnimSequence::GetNumberOfFrames() const
 
 int32 UPaperZDAnimSequence::GetFrameAtTime(const float Time) const
 {
+#if !WITH_EDITOR
+	if (Timeline.bBaked)
+	{
+		return Timeline.GetFrameAtTime(Time);
+	}
+#endif
+
 	const int32 NumFrames = GetNumberOfFrames();
 	const int32 Frame = NumFrames > 0 ? FMath::RoundToInt(Time * GetFramesPerSecond()) : 0;
 	return FMath::Clamp(Frame, 0, NumFrames);
@@ -112,6 +164,22 @@ float UPaperZDAnimSequence::GetTimeAtFrame(const int32 Frame) const
 	return FMath::Clamp(Time, 0.0f, GetTotalDuration());
 }
 
+int32 UPaperZDAnimSequence::GetNumDirections() const
+{
+	if (!bDirectionalSequence)
+	{
+		return 1;
+	}
+	else if (IsDirectionalDataBaked())
+	{
+		return BakedNumDirections;
+	}
+
+	//Data source changed since the last bake, resolve through reflection
+	FArrayProperty* ArrayProperty = GetAnimDataSourceProperty();
+	return ArrayProperty ? FMath::Max(FScriptArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<uint8>(this)).Num(), 1) : 1;
+}
+
 FArrayProperty* UPaperZDAnimSequence::GetAnimDataSourceProperty() const
 {
 	return CachedAnimDataSourceProperty;
@@ -140,6 +208,57 @@ void UPaperZDAnimSequence::InitDataSource()
 			bDirectionalSequence = false;
 		}
 	}
+
+	BakeDirectionalData();
+}
+
+void UPaperZDAnimSequence::BakeTimeline()
+{
+	Timeline.Duration = GetTotalDuration();
+	Timeline.FramesPerSecond = GetFramesPerSecond();
+	Timeline.NumFrames = GetNumberOfFrames();
+
+	Timeline.Notifies.Reset(AnimNotifies.Num());
+	for (UPaperZDAnimNotify_Base* Notify : AnimNotifies)
+	{
+		if (Notify)
+		{
+			const UPaperZDAnimNotifyState* NotifyState = Cast<UPaperZDAnimNotifyState>(Notify);
+			FPaperZDAnimTimelineNotify& Entry = Timeline.Notifies.AddDefaulted_GetRef();
+			Entry.StartTime = Notify->Time;
+			Entry.EndTime = NotifyState ? Notify->Time + NotifyState->Duration : Notify->Time;
+			Entry.Notify = Notify;
+		}
+	}
+
+	//Stable, so notifies on the same time keep the order they're triggered on with the unsorted list
+	Timeline.Notifies.StableSort([](const FPaperZDAnimTimelineNotify& A, const FPaperZDAnimTimelineNotify& B) { return A.StartTime < B.StartTime; });
+	Timeline.Notifies.Shrink();
+	Timeline.bBaked = true;
+}
+
+void UPaperZDAnimSequence::BakeDirectionalData()
+{
+	BakedDataSource = nullptr;
+	BakedElementSize = 0;
+	BakedNumDirections = 0;
+	BakedAngleBias = 0.0f;
+	BakedInvAngleSeparation = 0.0f;
+
+	if (CachedAnimDataSourceProperty)
+	{
+		const FScriptArray* DataSource = CachedAnimDataSourceProperty->ContainerPtrToValuePtr<FScriptArray>(this);
+		const int32 Num = DataSource->Num();
+		if (Num > 0)
+		{
+			const float AngleSeparation = 360.0f / Num;
+			BakedDataSource = DataSource;
+			BakedElementSize = CachedAnimDataSourceProperty->Inner->ElementSize;
+			BakedNumDirections = Num;
+			BakedAngleBias = DirectionalAngleOffset + AngleSeparation / 2.0f + 360.0f;
+			BakedInvAngleSeparation = 1.0f / AngleSeparation;
+		}
+	}
 }
 
 #if WITH_EDITOR
@@ -149,6 +268,17 @@ void UPaperZDAnimSequence::PostEditUndo()
 
 	//@TODO: we can get away with removing this by adding a listener on the editor window instead
 	OnPostEditUndo.ExecuteIfBound();
+
+	//Undo can change both the data source and the angle offset
+	BakeDirectionalData();
+	BakeTimeline();
+}
+
+void UPaperZDAnimSequence::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	BakeDirectionalData();
+	BakeTimeline();
 }
 
 int32 UPaperZDAnimSequence::CreateTrack(int32 InsertInto /* = INDEX_NONE */)
@@ -21,6 +21,7 @@ void UPaperZDAnimSequence_Flipbook::PostLoad()
 		AnimDataSource.SetNum(1);
 		AnimDataSource[0] = Flipbook_DEPRECATED;
 		bDirectionalSequence = false;
+		BakeDirectionalData();
 	}
 }
 
@@ -23,6 +23,14 @@ UPaperZDAnimPlayer::UPaperZDAnimPlayer() : Super()
 	PlaybackMode = EAnimPlayerPlaybackMode::Forward;
 	bPreviewPlayer = false;
 	bFireSequenceChangedEvents = false;
+	bUseFixedTimestep = false;
+	FixedTimestep = 1.0f / 60.0f;
+	MaxSubstepsPerFrame = 8;
+	FixedTimestepAccumulator = 0.0f;
+	CurrentSubstepIndex = 0;
+	CurrentSubstepTime = 0.0f;
+	CurrentNotifyTime = 0.0f;
+	bRecordProcessedNotifies = false;
 }
 
 float UPaperZDAnimPlayer::GetCurrentPlaybackTime() const
@@ -33,7 +41,7 @@ float UPaperZDAnimPlayer::GetCurrentPlaybackTime() const
 float UPaperZDAnimPlayer::GetPlaybackProgress() const
 {	
 	const UPaperZDAnimSequence* PrimaryAnimSequence = LastWeightedAnimation.AnimSequencePtr.Get();
-	return PrimaryAnimSequence && PrimaryAnimSequence->GetTotalDuration() > 0.0f ? LastWeightedAnimation.PlaybackTime / PrimaryAnimSequence->GetTotalDuration() : 0.0f;
+	return PrimaryAnimSequence && PrimaryAnimSequence->GetPlaybackDuration() > 0.0f ? LastWeightedAnimation.PlaybackTime / PrimaryAnimSequence->GetPlaybackDuration() : 0.0f;
 }
 
 const UPaperZDAnimSequence* UPaperZDAnimPlayer::GetCurrentAnimSequence() const
@@ -81,6 +89,38 @@ void UPaperZDAnimPlayer::SetIsPreviewPlayer(bool bInPreviewPlayer)
 	bPreviewPlayer = bInPreviewPlayer;
 }
 
+int32 UPaperZDAnimPlayer::ConsumeFixedTimesteps(float DeltaTime)
+{
+	const float StepTime = FMath::Max(FixedTimestep, KINDA_SMALL_NUMBER);
+	FixedTimestepAccumulator += DeltaTime;
+
+	int32 NumSubsteps = FMath::FloorToInt(FixedTimestepAccumulator / StepTime);
+	if (NumSubsteps > MaxSubstepsPerFrame)
+	{
+		//Drop the time we can't catch up with, keeping only the fraction of a substep
+		NumSubsteps = FMath::Max(MaxSubstepsPerFrame, 1);
+		FixedTimestepAccumulator = FMath::Fmod(FixedTimestepAccumulator, StepTime);
+	}
+	else
+	{
+		FixedTimestepAccumulator -= NumSubsteps * StepTime;
+	}
+
+	return NumSubsteps;
+}
+
+void UPaperZDAnimPlayer::BeginSubstep(int32 SubstepIndex)
+{
+	CurrentSubstepIndex = SubstepIndex;
+	CurrentSubstepTime = (SubstepIndex + 1) * FixedTimestep;
+}
+
+void UPaperZDAnimPlayer::EndSubsteps()
+{
+	CurrentSubstepIndex = 0;
+	CurrentSubstepTime = 0.0f;
+}
+
 bool UPaperZDAnimPlayer::IsRelevantWeight(float Weight) const
 {
 	return Weight > MIN_RELEVANT_WEIGHT;
@@ -89,7 +129,7 @@ bool UPaperZDAnimPlayer::IsRelevantWeight(float Weight) const
 //Playback controls
 void UPaperZDAnimPlayer::TickPlayback(const UPaperZDAnimSequence* AnimSequence, float& PlaybackMarker, float DeltaTime, bool bLooping, UPaperZDAnimInstance* OwningInstance /* = nullptr */, float EffectiveWeight /* = 1.0f */, bool bSkipNotifies /* = false */)
 {
-	if (AnimSequence && AnimSequence->GetTotalDuration() > 0.0f && bPlaying)
+	if (AnimSequence && AnimSequence->GetPlaybackDuration() > 0.0f && bPlaying)
 	{
 		float PreviousTime = PlaybackMarker;
 		bool bSequencePlaybackComplete = false;
@@ -115,14 +155,14 @@ void UPaperZDAnimPlayer::TickPlayback(const UPaperZDAnimSequence* AnimSequence,
 		if (DeltaTime > 0.0f)
 		{
 			PlaybackMarker += DeltaTime;
-			bSequencePlaybackComplete = PlaybackMarker >= AnimSequence->GetTotalDuration();
-			PlaybackMarker = bLooping ? FMath::Fmod(PlaybackMarker, AnimSequence->GetTotalDuration()) : FMath::Min(PlaybackMarker, AnimSequence->GetTotalDuration());
+			bSequencePlaybackComplete = PlaybackMarker >= AnimSequence->GetPlaybackDuration();
+			PlaybackMarker = bLooping ? FMath::Fmod(PlaybackMarker, AnimSequence->GetPlaybackDuration()) : FMath::Min(PlaybackMarker, AnimSequence->GetPlaybackDuration());
 		}
 		else if (DeltaTime < 0.0f)
 		{
 			PlaybackMarker += DeltaTime;
 			bSequencePlaybackComplete = PlaybackMarker <= 0.0f;
-			const float Duration = AnimSequence->GetTotalDuration();
+			const float Duration = AnimSequence->GetPlaybackDuration();
 			PlaybackMarker = bLooping && bSequencePlaybackComplete ? Duration + PlaybackMarker : FMath::Max(PlaybackMarker, 0);
 		}
 		
@@ -145,6 +185,10 @@ void UPaperZDAnimPlayer::TickPlayback(const UPaperZDAnimSequence* AnimSequence,
 			{
 				OnPlaybackSequenceComplete.Broadcast(AnimSequence);
 				OnPlaybackSequenceComplete_Native.Broadcast(AnimSequence);
+				for (bool* pFlag : SequenceCompleteFlags)
+				{
+					*pFlag = true;
+				}
 			}
 		}
 	}
@@ -153,7 +197,78 @@ void UPaperZDAnimPlayer::TickPlayback(const UPaperZDAnimSequence* AnimSequence,
 void UPaperZDAnimPlayer::ProcessAnimSequenceNotifies(const UPaperZDAnimSequence* AnimSequence, float DeltaTime, float CurrentTime, float PreviousTime, float Weight /* = 1.0f */, UPaperZDAnimInstance* OwningInstance /* = nullptr */)
 {
 	const bool bIsRelevant = IsRelevantWeight(Weight);
-	if (bIsRelevant && RegisteredRenderComponent.IsValid())
+	if (bIsRelevant && RegisteredRenderComponent.IsValid() && AnimSequence->CanUseBakedNotifies())
+	{
+		//Only the notifies that overlap the played window can do anything this update, along with those that were active before it and need to know they ended
+		const FPaperZDAnimSequenceTimeline& Timeline = AnimSequence->GetTimeline();
+		const int32 FirstHandle = DeferredAnimNotifyUpdateHandles.Num();
+		auto AddHandle = [&](UPaperZDAnimNotify_Base* Notify)
+		{
+#if WITH_EDITOR
+			//Prevent from firing in editor if specifically requested
+			if (OwningInstance == nullptr && !Notify->bShouldFireInEditor)
+			{
+				return;
+			}
+#endif
+			DeferredAnimNotifyUpdateHandles.Add(FAnimNotifyUpdateHandle(Notify, DeltaTime, CurrentTime, PreviousTime, OwningInstance, CurrentSubstepIndex, CurrentSubstepTime));
+		};
+		auto AddHandleUnique = [&](UPaperZDAnimNotify_Base* Notify)
+		{
+			for (int32 i = FirstHandle; i < DeferredAnimNotifyUpdateHandles.Num(); i++)
+			{
+				if (DeferredAnimNotifyUpdateHandles[i].AnimNotifyPtr.Get() == Notify)
+				{
+					return;
+				}
+			}
+			AddHandle(Notify);
+		};
+
+		const bool bLooped = DeltaTime > 0.0f ? CurrentTime < PreviousTime : CurrentTime > PreviousTime;
+		if (bLooped)
+		{
+			const float LoopEnd = FMath::Max(CurrentTime, PreviousTime);
+			const float LoopStart = FMath::Min(CurrentTime, PreviousTime);
+			Timeline.ForEachNotifyInRange(LoopEnd, Timeline.Duration, AddHandle);
+
+			//Long notify states can overlap both sides of the loop
+			Timeline.ForEachNotifyInRange(0.0f, LoopStart, AddHandleUnique);
+		}
+		else
+		{
+			Timeline.ForEachNotifyInRange(FMath::Min(CurrentTime, PreviousTime), FMath::Max(CurrentTime, PreviousTime), AddHandle);
+		}
+
+		//Previously active notifies are the ones processed on the last update: the active set for the first substep, or the handles queued by the previous substep of this frame
+		auto AddIfPreviouslyActive = [&](const FAnimNotifyUpdateHandle& Handle)
+		{
+			UPaperZDAnimNotify_Base* Notify = Handle.AnimNotifyPtr.Get();
+			if (Notify && Notify->GetOuter() == AnimSequence)
+			{
+				AddHandleUnique(Notify);
+			}
+		};
+
+		if (CurrentSubstepIndex == 0)
+		{
+			for (const FAnimNotifyUpdateHandle& Handle : ActiveNotifies)
+			{
+				AddIfPreviouslyActive(Handle);
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < FirstHandle; i++)
+			{
+				if (DeferredAnimNotifyUpdateHandles[i].SubstepIndex == CurrentSubstepIndex - 1)
+				{
+					AddIfPreviouslyActive(DeferredAnimNotifyUpdateHandles[i]);
+				}
+			}
+		}
+	}
+	else if (bIsRelevant && RegisteredRenderComponent.IsValid())
 	{
 		for (UPaperZDAnimNotify_Base* Notify : AnimSequence->GetAnimNotifies())
 		{
@@ -163,7 +278,7 @@ void UPaperZDAnimPlayer::ProcessAnimSequenceNotifies(const UPaperZDAnimSequence*
 #endif
 			{
 				//Add the notify to the list of deferred updates to do after the render pass
-				DeferredAnimNotifyUpdateHandles.Add(FAnimNotifyUpdateHandle(Notify, DeltaTime, CurrentTime, PreviousTime, OwningInstance));
+				DeferredAnimNotifyUpdateHandles.Add(FAnimNotifyUpdateHandle(Notify, DeltaTime, CurrentTime, PreviousTime, OwningInstance, CurrentSubstepIndex, CurrentSubstepTime));
 			}
 		}
 	}
@@ -228,35 +343,81 @@ void UPaperZDAnimPlayer::RegisterRenderComponent(UPrimitiveComponent* RenderComp
 
 void UPaperZDAnimPlayer::ProcessDeferredAnimNotifies()
 {
-	SCOPE_CYCLE_COUNTER(STAT_AnimNotifyTick);
+	SCOPE_PAPERZD_PHASE_COUNTER(STAT_AnimNotifyTick, EPaperZDRuntimePhase::AnimNotifyTick);
 
 	UPrimitiveComponent* RenderComponent = RegisteredRenderComponent.Get();
-	TSet<FAnimNotifyUpdateHandle> LastFrameActiveNotifies = MoveTemp(ActiveNotifies);
-	for (const FAnimNotifyUpdateHandle& Handle : DeferredAnimNotifyUpdateHandles)
+	TSet<FAnimNotifyUpdateHandle>& LastFrameActiveNotifies = PreviousActiveNotifies;
+
+	//Handles are stored in the order their substeps were simulated, each substep is processed as its own update so notify states persist correctly between them.
+	//Without fixed timesteps every handle belongs to the same (single) substep.
+	int32 GroupStart = 0;
+	do
 	{
-		if (Handle.AnimNotifyPtr.IsValid())
+		int32 GroupEnd = GroupStart;
+		while (GroupEnd < DeferredAnimNotifyUpdateHandles.Num() && DeferredAnimNotifyUpdateHandles[GroupEnd].SubstepIndex == DeferredAnimNotifyUpdateHandles[GroupStart].SubstepIndex)
 		{
-			//Obtain the current state and clear from the list of active notifies as this now got processed
-			bool bCurrentlyActive = LastFrameActiveNotifies.Contains(Handle);
-			LastFrameActiveNotifies.Remove(Handle);
+			GroupEnd++;
+		}
 
-			//Process the notify and persist the state
-			Handle.AnimNotifyPtr->TickNotify(Handle.DeltaTime, Handle.CurrentTime, Handle.PreviousTime, RenderComponent, bCurrentlyActive, Handle.OwningInstance);
-			if (bCurrentlyActive)
+		Swap(LastFrameActiveNotifies, ActiveNotifies);
+		ActiveNotifies.Reset();
+		for (int32 i = GroupStart; i < GroupEnd; i++)
+		{
+			const FAnimNotifyUpdateHandle& Handle = DeferredAnimNotifyUpdateHandles[i];
+			if (Handle.AnimNotifyPtr.IsValid())
 			{
-				ActiveNotifies.Add(Handle);
+				//Obtain the current state and clear from the list of active notifies as this now got processed
+				bool bCurrentlyActive = LastFrameActiveNotifies.Contains(Handle);
+				LastFrameActiveNotifies.Remove(Handle);
+
+				//Process the notify and persist the state
+				CurrentNotifyTime = Handle.SubstepTime;
+				Handle.AnimNotifyPtr->TickNotify(Handle.DeltaTime, Handle.CurrentTime, Handle.PreviousTime, RenderComponent, bCurrentlyActive, Handle.OwningInstance);
+				if (bCurrentlyActive)
+				{
+					ActiveNotifies.Add(Handle);
+				}
 			}
 		}
-	}
 
-	//Then let any notify that got interrupted by not being processed this frame that they got aborted
-	for (FAnimNotifyUpdateHandle& Handle : LastFrameActiveNotifies)
-	{
-		if (Handle.AnimNotifyPtr.IsValid())
+		//Then let any notify that got interrupted by not being processed this frame that they got aborted
+		for (FAnimNotifyUpdateHandle& Handle : LastFrameActiveNotifies)
 		{
-			Handle.AnimNotifyPtr->OnNotifyAborted(Handle.OwningInstance);
+			if (Handle.AnimNotifyPtr.IsValid())
+			{
+				Handle.AnimNotifyPtr->OnNotifyAborted(Handle.OwningInstance);
+			}
 		}
+
+		//Keep the storage around for the next update
+		LastFrameActiveNotifies.Reset();
+		GroupStart = GroupEnd;
+	}
+	while (GroupStart < DeferredAnimNotifyUpdateHandles.Num());
+
+	CurrentNotifyTime = 0.0f;
+	if (bRecordProcessedNotifies)
+	{
+		LastProcessedNotifyHandles.Reset();
+		LastProcessedNotifyHandles.Append(DeferredAnimNotifyUpdateHandles);
+	}
+	DeferredAnimNotifyUpdateHandles.Reset();
+}
+
+void UPaperZDAnimPlayer::SetRecordProcessedNotifies(bool bRecord)
+{
+	bRecordProcessedNotifies = bRecord;
+	if (!bRecord)
+	{
+		LastProcessedNotifyHandles.Empty();
 	}
+}
 
-	DeferredAnimNotifyUpdateHandles.Empty();
+void UPaperZDAnimPlayer::QueueNotifiesFrom(const UPaperZDAnimPlayer* Source, UPaperZDAnimInstance* Instance)
+{
+	for (const FAnimNotifyUpdateHandle& Handle : Source->LastProcessedNotifyHandles)
+	{
+		FAnimNotifyUpdateHandle& QueuedHandle = DeferredAnimNotifyUpdateHandles.Add_GetRef(Handle);
+		QueuedHandle.OwningInstance = Instance;
+	}
 }
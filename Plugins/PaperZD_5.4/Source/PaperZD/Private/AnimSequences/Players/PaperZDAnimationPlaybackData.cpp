@@ -4,10 +4,10 @@
 
 void FPaperZDAnimationPlaybackData::SetAnimation(const UPaperZDAnimSequence* Sequence, float PlaybackTime)
 {
-	WeightedAnimations.Empty(1);
+	WeightedAnimations.Reset();
 	FPaperZDWeightedAnimation& AnimWeight = WeightedAnimations.AddDefaulted_GetRef();
 	AnimWeight.AnimSequencePtr = Sequence;
-	AnimWeight.PlaybackTime = FMath::Clamp(PlaybackTime, 0.0f, Sequence->GetTotalDuration());
+	AnimWeight.PlaybackTime = FMath::Clamp(PlaybackTime, 0.0f, Sequence->GetPlaybackDuration());
 }
 
 void FPaperZDAnimationPlaybackData::RemoveWeights()
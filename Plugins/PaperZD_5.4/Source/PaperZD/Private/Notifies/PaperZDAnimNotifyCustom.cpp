@@ -10,6 +10,7 @@
 
 UPaperZDAnimNotifyCustom::UPaperZDAnimNotifyCustom(const FObjectInitializer& ObjectInitializer)
 	: Super()
+	, CachedNotifyIndex(INDEX_NONE)
 {
 }
 
@@ -18,14 +19,14 @@ void UPaperZDAnimNotifyCustom::OnReceiveNotify_Implementation(UPaperZDAnimInstan
 	//Owning instance can be null on editor
 	if (OwningInstance)
 	{
-		//Ask the instance for the function implementation
-		UFunction* BoundFunction = OwningInstance->FindAnimNotifyFunction(Name);
-		if (ensure(BoundFunction)) 
+		//The cached index stays valid across every AnimBP that shares the animation source, only resolve it by name when it doesn't match
+		UPaperZDAnimBPGeneratedClass* AnimClass = GetAnimClass(OwningInstance);
+		if (AnimClass && AnimClass->GetAnimNotifyName(CachedNotifyIndex) != Name)
 		{
-			//Create Buffer and call function
-			uint8 *Buffer = (uint8*)FMemory_Alloca(BoundFunction->ParmsSize);
-			FMemory::Memzero(Buffer, BoundFunction->ParmsSize);
-			OwningInstance->ProcessEvent(BoundFunction, Buffer);
+			CachedNotifyIndex = AnimClass->GetAnimNotifyIndex(Name);
 		}
+
+		const bool bHandled = OwningInstance->TriggerAnimNotify(CachedNotifyIndex);
+		ensure(bHandled);
 	}
 }
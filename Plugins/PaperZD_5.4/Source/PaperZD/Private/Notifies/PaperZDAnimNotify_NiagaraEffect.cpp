@@ -13,6 +13,7 @@ UPaperZDAnimNotify_NiagaraEffect::UPaperZDAnimNotify_NiagaraEffect()
 {
 	bAttached = true;
 	Scale = FVector(1.f);
+	bUseEffectPool = true;
 
 #if WITH_EDITORONLY_DATA
 	Color = FColor(192, 255, 99, 255);
@@ -61,14 +62,16 @@ void UPaperZDAnimNotify_NiagaraEffect::OnReceiveNotify_Implementation(UPaperZDAn
 			return;
 		}
 
+		//Pooled components go back to the world pool by themselves once the one shot effect finishes
+		const ENCPoolMethod PoolMethod = bUseEffectPool ? ENCPoolMethod::AutoRelease : ENCPoolMethod::None;
 		if (bAttached)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, true, ENCPoolMethod::None);
+			UNiagaraFunctionLibrary::SpawnSystemAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, true, PoolMethod);
 		}
 		else
 		{
 			const FTransform Transform = SequenceRenderComponent->GetSocketTransform(SocketName);
-			UFXSystemComponent* System = UNiagaraFunctionLibrary::SpawnSystemAtLocation(SequenceRenderComponent.Get(), PSTemplate, Transform.TransformPosition(LocationOffset), (Transform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true);
+			UFXSystemComponent* System = UNiagaraFunctionLibrary::SpawnSystemAtLocation(SequenceRenderComponent.Get(), PSTemplate, Transform.TransformPosition(LocationOffset), (Transform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true, true, PoolMethod);
 		}
 	}
 	else if (!PSTemplate)
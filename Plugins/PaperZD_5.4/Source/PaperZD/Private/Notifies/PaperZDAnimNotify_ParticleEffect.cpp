@@ -14,6 +14,7 @@ UPaperZDAnimNotify_ParticleEffect::UPaperZDAnimNotify_ParticleEffect()
 {
 	bAttached = true;
 	Scale = FVector(1.f);
+	bUseEffectPool = true;
 
 #if WITH_EDITORONLY_DATA
 	Color = FColor(192, 255, 99, 255);
@@ -62,9 +63,11 @@ void UPaperZDAnimNotify_ParticleEffect::OnReceiveNotify_Implementation(UPaperZDA
 			return;
 		}
 
+		//Pooled components go back to the world pool by themselves once the one shot effect finishes
+		const EPSCPoolMethod PoolMethod = bUseEffectPool ? EPSCPoolMethod::AutoRelease : EPSCPoolMethod::None;
 		if (bAttached)
 		{
-			UGameplayStatics::SpawnEmitterAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale);
+			UGameplayStatics::SpawnEmitterAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, true, PoolMethod);
 		}
 		else
 		{
@@ -73,7 +76,7 @@ void UPaperZDAnimNotify_ParticleEffect::OnReceiveNotify_Implementation(UPaperZDA
 			SpawnTransform.SetLocation(Transform.TransformPosition(LocationOffset));
 			SpawnTransform.SetRotation(Transform.GetRotation() * RotationOffsetQuat);
 			SpawnTransform.SetScale3D(Scale);
-			UParticleSystemComponent* System = UGameplayStatics::SpawnEmitterAtLocation(SequenceRenderComponent->GetWorld(), PSTemplate, SpawnTransform);
+			UParticleSystemComponent* System = UGameplayStatics::SpawnEmitterAtLocation(SequenceRenderComponent->GetWorld(), PSTemplate, SpawnTransform, true, PoolMethod);
 		}
 	}
 	else if (!PSTemplate)
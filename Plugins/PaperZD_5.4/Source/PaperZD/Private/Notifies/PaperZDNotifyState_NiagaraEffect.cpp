@@ -13,6 +13,7 @@ UPaperZDNotifyState_NiagaraEffect::UPaperZDNotifyState_NiagaraEffect()
 {
 	bDestroyAtEnd = false;
 	Scale = FVector(1.f);
+	bUseEffectPool = true;
 
 #if WITH_EDITORONLY_DATA
 	Color = FColor(192, 255, 99, 255);
@@ -54,10 +55,19 @@ void UPaperZDNotifyState_NiagaraEffect::OnNotifyBegin_Implementation(UPaperZDAni
 {
 	if (PSTemplate && SequenceRenderComponent.IsValid())
 	{
-		UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, !bDestroyAtEnd, ENCPoolMethod::None);
+		//Pooled components go back to the world pool once the system completes, which the end of the notify triggers even for looping systems
+		const ENCPoolMethod PoolMethod = bUseEffectPool ? ENCPoolMethod::AutoRelease : ENCPoolMethod::None;
+		UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, !bDestroyAtEnd, PoolMethod);
 		if (Component)
 		{
 			Component->ComponentTags.AddUnique(GetSpawnedComponentTag());
+
+			//The system can finish before the notify ends (or the owner can go away), make sure the pooled component doesn't keep our tag
+			if (bUseEffectPool)
+			{
+				UPaperZDNotifyState_NiagaraEffect* MutableThis = const_cast<UPaperZDNotifyState_NiagaraEffect*>(this);
+				Component->OnSystemFinished.AddUniqueDynamic(MutableThis, &UPaperZDNotifyState_NiagaraEffect::OnSpawnedSystemFinished);
+			}
 		}
 	}
 	else if (!PSTemplate)
@@ -67,6 +77,15 @@ void UPaperZDNotifyState_NiagaraEffect::OnNotifyBegin_Implementation(UPaperZDAni
 	}
 }
 
+void UPaperZDNotifyState_NiagaraEffect::OnSpawnedSystemFinished(UNiagaraComponent* Component)
+{
+	if (Component)
+	{
+		Component->ComponentTags.Remove(GetSpawnedComponentTag());
+		Component->OnSystemFinished.RemoveDynamic(this, &UPaperZDNotifyState_NiagaraEffect::OnSpawnedSystemFinished);
+	}
+}
+
 void UPaperZDNotifyState_NiagaraEffect::OnNotifyEnd_Implementation(UPaperZDAnimInstance* OwningInstance) const
 {
 	if (SequenceRenderComponent.IsValid())
@@ -84,7 +103,12 @@ void UPaperZDNotifyState_NiagaraEffect::OnNotifyEnd_Implementation(UPaperZDAnimI
 
 					// Either destroy the component or deactivate it to have it's active particles finish.
 					// The component will auto destroy once all particle are gone.
-					if (bDestroyAtEnd)
+					// Pooled components are never destroyed, completing them right away hands them back to the pool.
+					if (bDestroyAtEnd && ParticleComponent->GetPoolingMethod() != ENCPoolMethod::None)
+					{
+						ParticleComponent->DeactivateImmediate();
+					}
+					else if (bDestroyAtEnd)
 					{
 						ParticleComponent->DestroyComponent();
 					}
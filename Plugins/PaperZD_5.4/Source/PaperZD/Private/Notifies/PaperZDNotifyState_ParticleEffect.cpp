@@ -15,6 +15,7 @@ UPaperZDNotifyState_ParticleEffect::UPaperZDNotifyState_ParticleEffect()
 {
 	bDestroyAtEnd = false;
 	Scale = FVector(1.f);
+	bUseEffectPool = true;
 
 #if WITH_EDITORONLY_DATA
 	Color = FColor(192, 255, 99, 255);
@@ -56,10 +57,19 @@ void UPaperZDNotifyState_ParticleEffect::OnNotifyBegin_Implementation(UPaperZDAn
 {
 	if (PSTemplate && SequenceRenderComponent.IsValid())
 	{
-		UParticleSystemComponent* Component = UGameplayStatics::SpawnEmitterAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, !bDestroyAtEnd);
+		//Pooled components go back to the world pool once the system completes, which the end of the notify triggers even for looping systems
+		const EPSCPoolMethod PoolMethod = bUseEffectPool ? EPSCPoolMethod::AutoRelease : EPSCPoolMethod::None;
+		UParticleSystemComponent* Component = UGameplayStatics::SpawnEmitterAttached(PSTemplate, SequenceRenderComponent.Get(), SocketName, LocationOffset, RotationOffset, Scale, EAttachLocation::KeepRelativeOffset, !bDestroyAtEnd, PoolMethod);
 		if (Component)
 		{
 			Component->ComponentTags.AddUnique(GetSpawnedComponentTag());
+
+			//The system can finish before the notify ends (or the owner can go away), make sure the pooled component doesn't keep our tag
+			if (bUseEffectPool)
+			{
+				UPaperZDNotifyState_ParticleEffect* MutableThis = const_cast<UPaperZDNotifyState_ParticleEffect*>(this);
+				Component->OnSystemFinished.AddUniqueDynamic(MutableThis, &UPaperZDNotifyState_ParticleEffect::OnSpawnedSystemFinished);
+			}
 		}
 	}
 	else if (!PSTemplate)
@@ -69,6 +79,15 @@ void UPaperZDNotifyState_ParticleEffect::OnNotifyBegin_Implementation(UPaperZDAn
 	}
 }
 
+void UPaperZDNotifyState_ParticleEffect::OnSpawnedSystemFinished(UParticleSystemComponent* Component)
+{
+	if (Component)
+	{
+		Component->ComponentTags.Remove(GetSpawnedComponentTag());
+		Component->OnSystemFinished.RemoveDynamic(this, &UPaperZDNotifyState_ParticleEffect::OnSpawnedSystemFinished);
+	}
+}
+
 void UPaperZDNotifyState_ParticleEffect::OnNotifyEnd_Implementation(UPaperZDAnimInstance* OwningInstance) const
 {
 	if (SequenceRenderComponent.IsValid())
@@ -86,7 +105,12 @@ void UPaperZDNotifyState_ParticleEffect::OnNotifyEnd_Implementation(UPaperZDAnim
 
 					// Either destroy the component or deactivate it to have it's active particles finish.
 					// The component will auto destroy once all particle are gone.
-					if (bDestroyAtEnd)
+					// Pooled components are never destroyed, completing them right away hands them back to the pool.
+					if (bDestroyAtEnd && ParticleComponent->PoolingMethod != EPSCPoolMethod::None)
+					{
+						ParticleComponent->DeactivateImmediate();
+					}
+					else if (bDestroyAtEnd)
 					{
 						ParticleComponent->DestroyComponent();
 					}
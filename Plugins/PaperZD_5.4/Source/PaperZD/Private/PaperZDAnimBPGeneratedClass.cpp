@@ -12,6 +12,8 @@
 
 UPaperZDAnimBPGeneratedClass::UPaperZDAnimBPGeneratedClass()
 	: Super()
+	, NumOverrideGroups(0)
+	, bAnimNotifyTableBuilt(false)
 {}
 
 void UPaperZDAnimBPGeneratedClass::Link(FArchive& Ar, bool bRelinkExistingProperties)
@@ -21,6 +23,8 @@ void UPaperZDAnimBPGeneratedClass::Link(FArchive& Ar, bool bRelinkExistingProper
 	//Link called twice, make sure arrays are emptied
 	AnimNodeProperties.Empty();
 	StateMachineNodeProperties.Empty();
+	AnimNodeOffsets.Empty();
+	StateMachineNodeOffsets.Empty();
 
 #if WITH_EDITORONLY_DATA
 	for (FPaperZDExposedValueHandler& Handler : EvaluateGraphExposedInputs)
@@ -39,12 +43,14 @@ void UPaperZDAnimBPGeneratedClass::Link(FArchive& Ar, bool bRelinkExistingProper
 			if (StructProp->Struct->IsChildOf(FPaperZDAnimNode_Base::StaticStruct()))
 			{
 				AnimNodeProperties.Add(StructProp);
+				AnimNodeOffsets.Add(StructProp->GetOffset_ForInternal());
 			}
 
 			//Add special nodes as well
 			if (StructProp->Struct->IsChildOf(FPaperZDAnimNode_StateMachine::StaticStruct()))
 			{
 				StateMachineNodeProperties.Add(StructProp);
+				StateMachineNodeOffsets.Add(StructProp->GetOffset_ForInternal());
 			}
 		}
 	}
@@ -56,10 +62,20 @@ void UPaperZDAnimBPGeneratedClass::PurgeClass(bool bRecompilingOnLoad)
 
 	//Clean data
 	AnimNodeProperties.Empty();
+	AnimNodeOffsets.Empty();
+	StateMachineNodeOffsets.Empty();
+	JumpLinkTargets.Empty();
 	EvaluateGraphExposedInputs.Empty();
 	StateMachines.Empty();
 	AnimNotifyFunctionMapping.Empty();
+	RegisteredNotifyNames.Empty();
+	AnimNotifyNames.Empty();
+	AnimNotifyIndices.Empty();
+	AnimNotifyFunctions.Empty();
+	bAnimNotifyTableBuilt = false;
 	RegisteredOverrideSlots.Empty();
+	OverrideSlotGroupIndices.Empty();
+	NumOverrideGroups = 0;
 	RootNodeProperty = nullptr;
 	SupportedAnimationSource = nullptr;
 }
@@ -93,6 +109,62 @@ void UPaperZDAnimBPGeneratedClass::CacheRequiredNodes(UObject* DefaultObject)
 			}
 		}
 	}
+
+	CacheOverrideSlotIndices();
+	CacheJumpLinkTargets(DefaultObject);
+
+	//The notify functions might have changed, rebuild the table on next use
+	bAnimNotifyTableBuilt = false;
+}
+
+void UPaperZDAnimBPGeneratedClass::CacheJumpLinkTargets(UObject* DefaultObject)
+{
+	JumpLinkTargets.Reset();
+	for (int32 NodeIndex = 0; NodeIndex < StateMachineNodeOffsets.Num(); NodeIndex++)
+	{
+		const FPaperZDAnimNode_StateMachine* StateMachineNode = GetStateMachineNode(DefaultObject, NodeIndex);
+		if (StateMachines.IsValidIndex(StateMachineNode->StateMachineIndex))
+		{
+			for (const TPair<FName, int32>& JumpLink : StateMachines[StateMachineNode->StateMachineIndex].JumpLinks)
+			{
+				JumpLinkTargets.FindOrAdd(JumpLink.Key).Add({ NodeIndex, JumpLink.Value });
+			}
+		}
+	}
+}
+
+void UPaperZDAnimBPGeneratedClass::CacheOverrideSlotIndices()
+{
+	//Indices are assigned by the compiler, but classes compiled on older versions won't have them
+	bool bValidIndices = true;
+	for (const TPair<FName, FPaperZDOverrideSlotDescriptor>& SlotPair : RegisteredOverrideSlots)
+	{
+		const FPaperZDOverrideSlotDescriptor& Descriptor = SlotPair.Value;
+		if (!FMath::IsWithin(Descriptor.SlotIndex, 0, RegisteredOverrideSlots.Num()) || !FMath::IsWithin(Descriptor.GroupIndex, 0, RegisteredOverrideSlots.Num()))
+		{
+			bValidIndices = false;
+			break;
+		}
+	}
+
+	if (!bValidIndices)
+	{
+		TArray<FName> GroupNames;
+		int32 SlotIndex = 0;
+		for (TPair<FName, FPaperZDOverrideSlotDescriptor>& SlotPair : RegisteredOverrideSlots)
+		{
+			SlotPair.Value.SlotIndex = SlotIndex++;
+			SlotPair.Value.GroupIndex = GroupNames.AddUnique(SlotPair.Value.GroupName);
+		}
+	}
+
+	NumOverrideGroups = 0;
+	OverrideSlotGroupIndices.SetNum(RegisteredOverrideSlots.Num());
+	for (const TPair<FName, FPaperZDOverrideSlotDescriptor>& SlotPair : RegisteredOverrideSlots)
+	{
+		NumOverrideGroups = FMath::Max(NumOverrideGroups, SlotPair.Value.GroupIndex + 1);
+		OverrideSlotGroupIndices[SlotPair.Value.SlotIndex] = SlotPair.Value.GroupIndex;
+	}
 }
 
 FPaperZDAnimNode_Sink* UPaperZDAnimBPGeneratedClass::GetRootNode(UObject* AnimInstanceObject) const
@@ -109,14 +181,20 @@ FPaperZDAnimNode_Sink* UPaperZDAnimBPGeneratedClass::GetRootNode(UObject* AnimIn
 TArray<FPaperZDAnimNode_StateMachine*> UPaperZDAnimBPGeneratedClass::GetStateMachineNodes(UObject* AnimInstanceObject) const
 {
 	TArray<FPaperZDAnimNode_StateMachine*> StateMachineNodes;
-	for (FStructProperty* StructProp : StateMachineNodeProperties)
+	StateMachineNodes.Reserve(StateMachineNodeOffsets.Num());
+	for (int32 Offset : StateMachineNodeOffsets)
 	{
-		StateMachineNodes.Add(StructProp->ContainerPtrToValuePtr<FPaperZDAnimNode_StateMachine>(AnimInstanceObject));
+		StateMachineNodes.Add(reinterpret_cast<FPaperZDAnimNode_StateMachine*>(reinterpret_cast<uint8*>(AnimInstanceObject) + Offset));
 	}
 
 	return StateMachineNodes;
 }
 
+FPaperZDAnimNode_StateMachine* UPaperZDAnimBPGeneratedClass::GetStateMachineNode(UObject* AnimInstanceObject, int32 Index) const
+{
+	return StateMachineNodeOffsets.IsValidIndex(Index) ? reinterpret_cast<FPaperZDAnimNode_StateMachine*>(reinterpret_cast<uint8*>(AnimInstanceObject) + StateMachineNodeOffsets[Index]) : nullptr;
+}
+
 UFunction* UPaperZDAnimBPGeneratedClass::FindAnimNotifyFunction(FName AnimNotifyName) const
 {
 	const FName* pAnimFunctionName = AnimNotifyFunctionMapping.Find(AnimNotifyName);
@@ -128,13 +206,75 @@ UFunction* UPaperZDAnimBPGeneratedClass::FindAnimNotifyFunction(FName AnimNotify
 	return nullptr;
 }
 
+void UPaperZDAnimBPGeneratedClass::ConditionalBuildAnimNotifyTable() const
+{
+	if (bAnimNotifyTableBuilt)
+	{
+		return;
+	}
+
+	AnimNotifyNames.Reset();
+	AnimNotifyIndices.Reset();
+	AnimNotifyFunctions.Reset();
+
+	//Use the list baked on compile, so editor and cooked builds agree on the indices
+	for (FName NotifyName : RegisteredNotifyNames)
+	{
+		if (!AnimNotifyIndices.Contains(NotifyName))
+		{
+			AnimNotifyIndices.Add(NotifyName, AnimNotifyNames.Add(NotifyName));
+		}
+	}
+
+	//Implemented notifies should always be registered on the source, but don't rely on it
+	for (const TPair<FName, FName>& NotifyPair : AnimNotifyFunctionMapping)
+	{
+		if (!AnimNotifyIndices.Contains(NotifyPair.Key))
+		{
+			AnimNotifyIndices.Add(NotifyPair.Key, AnimNotifyNames.Add(NotifyPair.Key));
+		}
+	}
+
+	AnimNotifyFunctions.SetNum(AnimNotifyNames.Num());
+	for (int32 i = 0; i < AnimNotifyNames.Num(); i++)
+	{
+		AnimNotifyFunctions[i] = FindAnimNotifyFunction(AnimNotifyNames[i]);
+	}
+
+	bAnimNotifyTableBuilt = true;
+}
+
+int32 UPaperZDAnimBPGeneratedClass::GetAnimNotifyIndex(FName AnimNotifyName) const
+{
+	ConditionalBuildAnimNotifyTable();
+	const int32* pIndex = AnimNotifyIndices.Find(AnimNotifyName);
+	return pIndex ? *pIndex : INDEX_NONE;
+}
+
+FName UPaperZDAnimBPGeneratedClass::GetAnimNotifyName(int32 AnimNotifyIndex) const
+{
+	ConditionalBuildAnimNotifyTable();
+	return AnimNotifyNames.IsValidIndex(AnimNotifyIndex) ? AnimNotifyNames[AnimNotifyIndex] : NAME_None;
+}
+
+UFunction* UPaperZDAnimBPGeneratedClass::GetAnimNotifyFunction(int32 AnimNotifyIndex) const
+{
+	ConditionalBuildAnimNotifyTable();
+	return AnimNotifyFunctions.IsValidIndex(AnimNotifyIndex) ? AnimNotifyFunctions[AnimNotifyIndex] : nullptr;
+}
+
+int32 UPaperZDAnimBPGeneratedClass::GetNumAnimNotifies() const
+{
+	ConditionalBuildAnimNotifyTable();
+	return AnimNotifyNames.Num();
+}
+
 FPaperZDAnimNode_Base* UPaperZDAnimBPGeneratedClass::GetAnimNodeByLinkID(UObject* AnimInstanceObject, int32 LinkID) const
 {
 	FPaperZDAnimNode_Base* AnimNode = nullptr;
-	if (AnimNodeProperties.IsValidIndex(LinkID))
+	if (AnimNodeOffsets.IsValidIndex(LinkID))
 	{
-		FStructProperty* LinkedProperty = AnimNodeProperties[LinkID];
-		AnimNode = LinkedProperty->ContainerPtrToValuePtr<FPaperZDAnimNode_Base>(AnimInstanceObject);
+		AnimNode = reinterpret_cast<FPaperZDAnimNode_Base*>(reinterpret_cast<uint8*>(AnimInstanceObject) + AnimNodeOffsets[LinkID]);
 	}
 
 	return AnimNode;
@@ -143,10 +283,9 @@ FPaperZDAnimNode_Base* UPaperZDAnimBPGeneratedClass::GetAnimNodeByLinkID(UObject
 FPaperZDAnimNode_Base* UPaperZDAnimBPGeneratedClass::GetAnimNodeByPropertyIndex(UObject* AnimInstanceObject, int32 Index) const
 {
 	FPaperZDAnimNode_Base* AnimNode = nullptr;
-	if (AnimNodeProperties.IsValidIndex(Index))
+	if (AnimNodeOffsets.IsValidIndex(Index))
 	{
-		FStructProperty* LinkedProperty = AnimNodeProperties.Last(Index);
-		AnimNode = LinkedProperty->ContainerPtrToValuePtr<FPaperZDAnimNode_Base>(AnimInstanceObject);
+		AnimNode = reinterpret_cast<FPaperZDAnimNode_Base*>(reinterpret_cast<uint8*>(AnimInstanceObject) + AnimNodeOffsets.Last(Index));
 	}
 
 	return AnimNode;
@@ -172,3 +311,22 @@ bool UPaperZDAnimBPGeneratedClass::GetOverrideSlotDescriptor(FName SlotName, FPa
 
 	return pDescriptor != nullptr;
 }
+
+int32 UPaperZDAnimBPGeneratedClass::GetOverrideSlotIndex(FName SlotName) const
+{
+	const FPaperZDOverrideSlotDescriptor* pDescriptor = RegisteredOverrideSlots.Find(SlotName);
+	return pDescriptor ? pDescriptor->SlotIndex : INDEX_NONE;
+}
+
+int32 UPaperZDAnimBPGeneratedClass::GetOverrideGroupIndex(FName GroupName) const
+{
+	for (const TPair<FName, FPaperZDOverrideSlotDescriptor>& SlotPair : RegisteredOverrideSlots)
+	{
+		if (SlotPair.Value.GroupName == GroupName)
+		{
+			return SlotPair.Value.GroupIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
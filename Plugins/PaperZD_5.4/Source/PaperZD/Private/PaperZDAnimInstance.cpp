@@ -2,6 +2,8 @@
 
 #include "PaperZDAnimInstance.h"
 #include "PaperZDAnimBPGeneratedClass.h"
+#include "PaperZDAnimSharingSubsystem.h"
+#include "PaperZDDirectionalitySubsystem.h"
 #include "PaperZDCharacter.h"
 #include "PaperZDStats.h"
 #include "AnimSequences/Sources/PaperZDAnimationSource.h"
@@ -11,6 +13,7 @@
 #include "AnimNodes/PaperZDAnimNode_PlaySequence.h"
 #include "Kismet/GameplayStatics.h"
 #include "Logging/MessageLog.h"
+#include "Engine/World.h"
 
 #if ZD_VERSION_INLINED_CPP_SUPPORT
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDAnimInstance)
@@ -31,6 +34,15 @@ UPaperZDAnimInstance::UPaperZDAnimInstance()
 	bIgnoreTimeDilation = false;
 	bAllowTransitionalStates = true;
 	bSequencerOverride = false;
+	LastOverrideSerialNumber = 0;
+	bEnableAnimationSharing = false;
+	AnimationSharingTimeStep = 1.0f / 15.0f;
+	AnimationSharingResyncInterval = 0.25f;
+	bResolveDirectionInBatch = false;
+	DirectionalPlane = EPaperZDDirectionPlane::SideView;
+	DirectionalSectors = 8;
+	DirectionalHysteresis = 5.0f;
+	DirectionalMinSpeed = 1.0f;
 }
 
 UWorld* UPaperZDAnimInstance::GetWorld() const
@@ -38,6 +50,20 @@ UWorld* UPaperZDAnimInstance::GetWorld() const
 	return Manager.GetObject() ? Manager->OnGetWorld() : nullptr;
 }
 
+void UPaperZDAnimInstance::BeginDestroy()
+{
+	//Don't leave our bucket pointing to us, followers would stop animating until their next resync
+	LeaveSharedAnimation();
+
+	//Same for the directionality batch, which would keep a dead entry around until its next resolve
+	if (UPaperZDDirectionalitySubsystem* DirectionalitySubsystem = DirectionalityState.Subsystem.Get())
+	{
+		DirectionalitySubsystem->UnregisterInstance(this);
+	}
+
+	Super::BeginDestroy();
+}
+
 UPaperZDAnimPlayer* UPaperZDAnimInstance::GetPlayer() const
 {
 	return AnimPlayer;
@@ -54,6 +80,94 @@ UFunction* UPaperZDAnimInstance::FindAnimNotifyFunction(FName AnimNotifyName) co
 	return AnimClass->FindAnimNotifyFunction(AnimNotifyName);
 }
 
+int32 UPaperZDAnimInstance::GetAnimNotifyIndex(FName AnimNotifyName) const
+{
+	UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass());
+	return AnimClass ? AnimClass->GetAnimNotifyIndex(AnimNotifyName) : INDEX_NONE;
+}
+
+bool UPaperZDAnimInstance::BindAnimNotify(FName AnimNotifyName, FZDOnAnimNotifyNativeSignature Delegate)
+{
+	if (FAnimNotifyHandler* Handler = FindOrAddAnimNotifyHandler(AnimNotifyName))
+	{
+		Handler->NativeDelegate = MoveTemp(Delegate);
+		return true;
+	}
+
+	return false;
+}
+
+bool UPaperZDAnimInstance::K2_BindAnimNotify(FName AnimNotifyName, FZDOnAnimNotifySignature Delegate)
+{
+	if (FAnimNotifyHandler* Handler = FindOrAddAnimNotifyHandler(AnimNotifyName))
+	{
+		Handler->ScriptDelegate = Delegate;
+		return true;
+	}
+
+	return false;
+}
+
+void UPaperZDAnimInstance::UnbindAnimNotify(FName AnimNotifyName)
+{
+	const int32 NotifyIndex = GetAnimNotifyIndex(AnimNotifyName);
+	if (AnimNotifyHandlers.IsValidIndex(NotifyIndex))
+	{
+		AnimNotifyHandlers[NotifyIndex].NativeDelegate.Unbind();
+		AnimNotifyHandlers[NotifyIndex].ScriptDelegate.Unbind();
+	}
+}
+
+bool UPaperZDAnimInstance::TriggerAnimNotify(int32 AnimNotifyIndex)
+{
+	bool bHandled = false;
+	if (AnimNotifyHandlers.IsValidIndex(AnimNotifyIndex))
+	{
+		FAnimNotifyHandler& Handler = AnimNotifyHandlers[AnimNotifyIndex];
+		if (Handler.NativeDelegate.IsBound())
+		{
+			Handler.NativeDelegate.Execute();
+			bHandled = true;
+		}
+
+		if (Handler.ScriptDelegate.IsBound())
+		{
+			Handler.ScriptDelegate.Execute();
+			bHandled = true;
+		}
+	}
+
+	//Call the AnimBP implementation, resolved when the class built its notify table
+	UPaperZDAnimBPGeneratedClass* AnimClass = CastChecked<UPaperZDAnimBPGeneratedClass>(GetClass());
+	if (UFunction* NotifyFunction = AnimClass->GetAnimNotifyFunction(AnimNotifyIndex))
+	{
+		uint8* Buffer = (uint8*)FMemory_Alloca(NotifyFunction->ParmsSize);
+		FMemory::Memzero(Buffer, NotifyFunction->ParmsSize);
+		ProcessEvent(NotifyFunction, Buffer);
+		bHandled = true;
+	}
+
+	return bHandled;
+}
+
+UPaperZDAnimInstance::FAnimNotifyHandler* UPaperZDAnimInstance::FindOrAddAnimNotifyHandler(FName AnimNotifyName)
+{
+	const int32 NotifyIndex = GetAnimNotifyIndex(AnimNotifyName);
+	if (NotifyIndex == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AnimInstance '%s' tried to bind to unknown AnimNotify '%s'."), *GetName(), *AnimNotifyName.ToString());
+		return nullptr;
+	}
+
+	//Bindings can happen before init
+	if (!AnimNotifyHandlers.IsValidIndex(NotifyIndex))
+	{
+		AnimNotifyHandlers.SetNum(NotifyIndex + 1);
+	}
+
+	return &AnimNotifyHandlers[NotifyIndex];
+}
+
 void UPaperZDAnimInstance::Tick(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TickAnimInstance);
@@ -63,8 +177,47 @@ void UPaperZDAnimInstance::Tick(float DeltaTime)
 		DeltaTime = GetDeltaTimeIgnoredDilation(DeltaTime);
 	}
 
-	//Process the animation nodes
-	ProcessAnimations(DeltaTime);
+	//While following a shared animation the bucket leader renders for us, we only need to know when to run our own graph again
+	bool bRunOwnGraph = true;
+	if (SharingState.bFollower)
+	{
+		SharingState.TimeSinceResync += DeltaTime;
+		if (SharingState.TimeSinceResync < AnimationSharingResyncInterval)
+		{
+			SharingState.PendingDeltaTime += DeltaTime;
+			bRunOwnGraph = false;
+		}
+		else
+		{
+			LeaveSharedAnimation();
+		}
+	}
+
+	if (bRunOwnGraph)
+	{
+		//Catch up with any time we skipped while following
+		if (SharingState.PendingDeltaTime > 0.0f)
+		{
+			CatchUpAnimations(SharingState.PendingDeltaTime);
+			SharingState.PendingDeltaTime = 0.0f;
+		}
+
+		//Process the animation nodes
+		ProcessAnimations(DeltaTime);
+
+		//Offer the frame we just rendered to other instances
+		if (UPaperZDAnimSharingSubsystem* SharingSubsystem = GetSharingSubsystem())
+		{
+			if (CanShareAnimation())
+			{
+				SharingSubsystem->RegisterEvaluation(this, BuildSharingKey(), AnimPlayer->GetLastPlaybackData());
+			}
+			else
+			{
+				LeaveSharedAnimation();
+			}
+		}
+	}
 
 	//Call the blueprint method, if it exists
 	{
@@ -83,13 +236,28 @@ void UPaperZDAnimInstance::Init(TScriptInterface<IPaperZDAnimInstanceManager> In
 	//Store the manager for later use
 	Manager = InManager;
 
-	//Cache the root node and supported sequence
+	//Cache the root node, state machines and supported sequence
 	RootNode = nullptr;
+	StateMachineNodes.Reset();
 	const UPaperZDAnimationSource* AnimSource = nullptr;
 	if (UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass()))
 	{
 		RootNode = AnimClass->GetRootNode(this);
 		AnimSource = AnimClass->GetSupportedAnimationSource();
+
+		for (int32 i = 0; i < AnimClass->GetNumStateMachineNodes(); i++)
+		{
+			StateMachineNodes.Add(AnimClass->GetStateMachineNode(this, i));
+		}
+
+		//Allocate the override storage upfront, so playing and updating overrides doesn't allocate
+		AnimationOverrideHandles.Reset();
+		AnimationOverrideHandles.SetNum(AnimClass->GetNumOverrideGroups());
+		ProcessedOverrideData.Reset();
+		ProcessedOverrideData.SetNum(AnimClass->GetNumOverrideSlots());
+
+		//Keep any notify callback bound before init
+		AnimNotifyHandlers.SetNum(FMath::Max(AnimNotifyHandlers.Num(), AnimClass->GetNumAnimNotifies()));
 	}
 
 	//Init the player
@@ -102,6 +270,12 @@ void UPaperZDAnimInstance::Init(TScriptInterface<IPaperZDAnimInstanceManager> In
 	AnimPlayer->OnPlaybackSequenceChanged.AddDynamic(this, &UPaperZDAnimInstance::OnAnimSequenceUpdated);
 	AnimPlayer->OnPlaybackSequenceComplete.AddDynamic(this, &UPaperZDAnimInstance::OnAnimSequencePlaybackComplete);
 
+	//Join the directionality batch
+	if (UPaperZDDirectionalitySubsystem* DirectionalitySubsystem = GetDirectionalitySubsystem())
+	{
+		DirectionalitySubsystem->RegisterInstance(this);
+	}
+
 	//Let the blueprint initialize any variables we might need for updates
 	//We do this first as some AnimNodes might require access to blueprint logic on their initialization methods
 	OnInit();
@@ -131,20 +305,24 @@ APaperZDCharacter* UPaperZDAnimInstance::GetPaperCharacter() const
 
 void UPaperZDAnimInstance::JumpToNode(FName JumpName, FName StateMachineName /* = NAME_None */)
 {
+	//Jumping changes our state independently of any bucket we were sharing
+	LeaveSharedAnimation();
+
 	UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass());
-	if (AnimClass)
+	const TArray<FPaperZDJumpLinkTarget, TInlineAllocator<1>>* pJumpTargets = AnimClass ? AnimClass->FindJumpLinkTargets(JumpName) : nullptr;
+	if (pJumpTargets)
 	{
 		FPaperZDAnimationBaseContext Context(this);
-		for (FPaperZDAnimNode_StateMachine* StateMachineNode : AnimClass->GetStateMachineNodes(this))
+		for (const FPaperZDJumpLinkTarget& JumpTarget : *pJumpTargets)
 		{
-			if (StateMachineName != NAME_None && StateMachineNode->GetMachineName() == StateMachineName)
+			FPaperZDAnimNode_StateMachine* StateMachineNode = StateMachineNodes.IsValidIndex(JumpTarget.StateMachineNodeIndex) ? StateMachineNodes[JumpTarget.StateMachineNodeIndex] : nullptr;
+			if (StateMachineNode && (StateMachineName == NAME_None || StateMachineNode->GetMachineName() == StateMachineName))
 			{
-				StateMachineNode->JumpToNode(JumpName, Context);
-				break;
-			}
-			else if (StateMachineName == NAME_None)
-			{ 
-				StateMachineNode->JumpToNode(JumpName, Context);
+				StateMachineNode->JumpToState(JumpTarget.TargetStateIndex, Context);
+				if (StateMachineName != NAME_None)
+				{
+					break;
+				}
 			}
 		}
 	}
@@ -155,80 +333,213 @@ void UPaperZDAnimInstance::ProcessAnimations(float DeltaTime)
 	if (RootNode)
 	{
 		{
-			SCOPE_CYCLE_COUNTER(STAT_UpdateAnimGraph);
+			SCOPE_PAPERZD_PHASE_COUNTER(STAT_UpdateAnimGraph, EPaperZDRuntimePhase::UpdateAnimGraph);
 
-			//Update any animation override first
-			UpdateAnimationOverrides(DeltaTime);
-
-			//First do a pass and update any animation node
-			FPaperZDAnimationUpdateContext UpdateContext(this, DeltaTime);
-			RootNode->Update(UpdateContext);
-
-			//We now clear the processed animation override data for next tick
-			ProcessedOverrideData.Empty(AnimationOverrideHandles.Num());
+			if (AnimPlayer->bUseFixedTimestep)
+			{
+				//Simulate in fixed substeps, each one collecting its own notifies
+				const int32 NumSubsteps = AnimPlayer->ConsumeFixedTimesteps(DeltaTime);
+				for (int32 Substep = 0; Substep < NumSubsteps; Substep++)
+				{
+					AnimPlayer->BeginSubstep(Substep);
+					UpdateAnimGraph(AnimPlayer->FixedTimestep);
+				}
+				AnimPlayer->EndSubsteps();
+
+				//Nothing changed since the last render
+				if (NumSubsteps == 0)
+				{
+					return;
+				}
+			}
+			else
+			{
+				UpdateAnimGraph(DeltaTime);
+			}
 		}
 
 		{
-			SCOPE_CYCLE_COUNTER(STAT_RenderAnimations);
+			SCOPE_PAPERZD_PHASE_COUNTER(STAT_RenderAnimations, EPaperZDRuntimePhase::RenderAnimations);
 
 			//Then evaluate the sink node, obtaining the final animation data
-			FPaperZDAnimationPlaybackData PlaybackData;
-			RootNode->Evaluate(PlaybackData);
+			EvaluationData.Reset();
+			RootNode->Evaluate(EvaluationData);
 
 			//Pass to the AnimPlayer
-			AnimPlayer->Play(PlaybackData);
+			AnimPlayer->Play(EvaluationData);
 		}
 	}
 }
 
+void UPaperZDAnimInstance::UpdateAnimGraph(float DeltaTime)
+{
+	//Update any animation override first
+	UpdateAnimationOverrides(DeltaTime);
+
+	//First do a pass and update any animation node
+	FPaperZDAnimationUpdateContext UpdateContext(this, DeltaTime);
+	RootNode->Update(UpdateContext);
+
+	//We now clear the processed animation override data for next tick
+	ClearProcessedOverrideData();
+}
+
 void UPaperZDAnimInstance::UpdateAnimationOverrides(float DeltaTime)
 {
-	for (int32 i = AnimationOverrideHandles.Num() - 1; i >= 0; i--)
+	//The handle storage is fixed, so references stay valid even if a notify plays or stops an override while we tick
+	for (FAnimationOverrideHandle& Handle : AnimationOverrideHandles)
 	{
-		FAnimationOverrideHandle& Handle = AnimationOverrideHandles[i];
-		AnimPlayer->TickPlayback(Handle.AnimSequencePtr.Get(), Handle.PlaybackTime, DeltaTime * Handle.PlayRate, false, this);
+		if (!Handle.IsActive())
+		{
+			continue;
+		}
 
-		//It could happen that after we tick playback of the AnimSequence, the AnimationOverrideHandles array changed somehow,
-		//either by removal of any of the Handles (by stopping an override) or by adding another handle on top (which would change the memory address of the array).
-		//Because of this we need to re-validate the handle before going further.
-		if (AnimationOverrideHandles.IsValidIndex(i))
+		//Tick on a local copy, as a notify could replace this override with a new one on the same group
+		const uint32 SerialNumber = Handle.SerialNumber;
+		const UPaperZDAnimSequence* AnimSequence = Handle.AnimSequencePtr.Get();
+		float PlaybackTime = Handle.PlaybackTime;
+		AnimPlayer->TickPlayback(AnimSequence, PlaybackTime, DeltaTime * Handle.PlayRate, false, this);
+
+		//Skip the override if it got stopped or replaced while ticking
+		if (Handle.SerialNumber != SerialNumber)
 		{
-			//Re-grab the handle to make sure we aren't pointing to stale data.
-			Handle = AnimationOverrideHandles[i];
+			continue;
+		}
 
-			//Check if the override completed
-			if ((Handle.PlayRate > 0.0f && Handle.PlaybackTime >= Handle.AnimSequencePtr->GetTotalDuration())
-				|| (Handle.PlayRate < 0.0f && Handle.PlaybackTime <= 0.0f))
-			{
-				//If we call the delegate right away it might happen that the user triggers another animation callback on the same slot/group,
-				//the system will then incorrectly assume that a "cancel" should be triggered as the OverrideHandle hasn't been unregistered yet.
-				//Because of this we need to make sure the handle has been removed before we trigger the callback.
-				// 
-				//We thus make a copy of the delegate object before removing the animation override.
-				FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = Handle.OnOverrideEnd;
-
-				//Remove from the array, so the handle gets correctly unregistered
-				AnimationOverrideHandles.RemoveAt(i);
-
-				//Now call the delegate
-				OnOverrideEnd_Copy.ExecuteIfBound(true);
-			}
-			else
-			{
-				//The override is still valid and we should pass it to the array of processed ones for slots to grab
-				FPaperZDAnimationPlaybackData PlaybackData;
-				PlaybackData.SetAnimation(Handle.AnimSequencePtr.Get(), Handle.PlaybackTime);
-				SetAnimationOverrideDataBySlot(Handle.SlotName, PlaybackData);
-			}
+		//Check if the override completed
+		Handle.PlaybackTime = PlaybackTime;
+		if (!AnimSequence
+			|| (Handle.PlayRate > 0.0f && Handle.PlaybackTime >= AnimSequence->GetPlaybackDuration())
+			|| (Handle.PlayRate < 0.0f && Handle.PlaybackTime <= 0.0f))
+		{
+			//If we call the delegate right away it might happen that the user triggers another animation callback on the same slot/group,
+			//the system will then incorrectly assume that a "cancel" should be triggered as the OverrideHandle hasn't been unregistered yet.
+			//Because of this we need to make sure the handle has been released before we trigger the callback.
+			FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = MoveTemp(Handle.OnOverrideEnd);
+			Handle = FAnimationOverrideHandle();
+
+			//Now call the delegate
+			OnOverrideEnd_Copy.ExecuteIfBound(true);
 		}
 		else
 		{
-			//The data we were iterating is stale, it's safer to skip the updates until the next tick
-			break;
+			//The override is still valid and we should pass it to the processed data for slots to grab
+			FProcessedAnimationOverrideData& ProcessedData = ProcessedOverrideData[Handle.SlotIndex];
+			ProcessedData.PlaybackData.SetAnimation(AnimSequence, Handle.PlaybackTime);
+			ProcessedData.bValid = true;
 		}
 	}
 }
 
+void UPaperZDAnimInstance::ClearProcessedOverrideData()
+{
+	for (FProcessedAnimationOverrideData& ProcessedData : ProcessedOverrideData)
+	{
+		ProcessedData.bValid = false;
+	}
+}
+
+bool UPaperZDAnimInstance::HasActiveAnimationOverrides() const
+{
+	for (const FAnimationOverrideHandle& Handle : AnimationOverrideHandles)
+	{
+		if (Handle.IsActive())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UPaperZDAnimInstance::CatchUpAnimations(float DeltaTime)
+{
+	if (RootNode)
+	{
+		SCOPE_PAPERZD_PHASE_COUNTER(STAT_UpdateAnimGraph, EPaperZDRuntimePhase::UpdateAnimGraph);
+
+		//Zero weight keeps the players from triggering any notify on the skipped time window
+		FPaperZDAnimationUpdateContext UpdateContext(this, DeltaTime);
+		RootNode->Update(UpdateContext.FractionalWeight(0.0f));
+		ClearProcessedOverrideData();
+	}
+}
+
+UPaperZDAnimSharingSubsystem* UPaperZDAnimInstance::GetSharingSubsystem() const
+{
+	if (bEnableAnimationSharing)
+	{
+		UWorld* World = GetWorld();
+		return World && World->IsGameWorld() ? World->GetSubsystem<UPaperZDAnimSharingSubsystem>() : nullptr;
+	}
+
+	return nullptr;
+}
+
+UPaperZDDirectionalitySubsystem* UPaperZDAnimInstance::GetDirectionalitySubsystem() const
+{
+	if (bResolveDirectionInBatch)
+	{
+		UWorld* World = GetWorld();
+		return World ? World->GetSubsystem<UPaperZDDirectionalitySubsystem>() : nullptr;
+	}
+
+	return nullptr;
+}
+
+bool UPaperZDAnimInstance::CanShareAnimation() const
+{
+	return RootNode && !SharingState.bSuspended && !bSequencerOverride && !HasActiveAnimationOverrides() && AnimPlayer->GetCurrentAnimSequence() != nullptr;
+}
+
+FPaperZDAnimSharingKey UPaperZDAnimInstance::BuildSharingKey() const
+{
+	//Sector size used to group directional angles, matches a 16-way directional sequence
+	static const float AngleSectorSize = 360.0f / 16.0f;
+
+	FPaperZDAnimSharingKey Key;
+	Key.AnimClass = GetClass();
+
+	const FPaperZDAnimationPlaybackData& PlaybackData = AnimPlayer->GetLastPlaybackData();
+	const FPaperZDWeightedAnimation& PrimaryAnimation = PlaybackData.WeightedAnimations[0];
+	Key.AnimSequence = PrimaryAnimation.AnimSequencePtr.Get();
+	Key.QuantizedTime = FMath::FloorToInt(PrimaryAnimation.PlaybackTime / AnimationSharingTimeStep);
+	Key.QuantizedAngle = FMath::FloorToInt(PlaybackData.DirectionalAngle / AngleSectorSize);
+
+	//Instances can only share if every state machine is on the same state
+	for (const FPaperZDAnimNode_StateMachine* StateMachineNode : StateMachineNodes)
+	{
+		Key.StateHash = HashCombine(Key.StateHash, GetTypeHash(StateMachineNode->GetCurrentStateIndex()));
+	}
+
+	return Key;
+}
+
+void UPaperZDAnimInstance::LeaveSharedAnimation()
+{
+	if (SharingState.BucketIndex != INDEX_NONE)
+	{
+		if (UPaperZDAnimSharingSubsystem* SharingSubsystem = SharingState.Subsystem.Get())
+		{
+			SharingSubsystem->RemoveInstance(this);
+		}
+		else
+		{
+			SharingState.BucketIndex = INDEX_NONE;
+			SharingState.bFollower = false;
+		}
+	}
+}
+
+void UPaperZDAnimInstance::SetAnimationSharingSuspended(bool bSuspended)
+{
+	SharingState.bSuspended = bSuspended;
+	if (bSuspended)
+	{
+		LeaveSharedAnimation();
+	}
+}
+
 float UPaperZDAnimInstance::GetDeltaTimeIgnoredDilation(float DeltaTime)
 {
 	const float timeDilation = UGameplayStatics::GetGlobalTimeDilation(this);
@@ -237,6 +548,7 @@ float UPaperZDAnimInstance::GetDeltaTimeIgnoredDilation(float DeltaTime)
 
 void UPaperZDAnimInstance::PrepareForMovieSequence()
 {
+	LeaveSharedAnimation();
 	bSequencerOverride = true;
 }
 
@@ -255,45 +567,67 @@ void UPaperZDAnimInstance::UpdateSequencerPreview()
 }
 
 bool UPaperZDAnimInstance::PlayAnimationOverride(const UPaperZDAnimSequence* AnimSequence, FName SlotName /* = "DefaultSlot" */, float PlayRate /* = 1.0f */, float StartingPosition /* = 0.0f */, FZDOnAnimationOverrideEndSignature OnOverrideEnd /* = FZDOnAnimationOverrideEndSignature() */)
+{
+	return PlayAnimationOverrideWithHandle(AnimSequence, SlotName, PlayRate, StartingPosition, OnOverrideEnd).IsValid();
+}
+
+FPaperZDAnimationOverrideHandle UPaperZDAnimInstance::PlayAnimationOverrideWithHandle(const UPaperZDAnimSequence* AnimSequence, FName SlotName /* = "DefaultSlot" */, float PlayRate /* = 1.0f */, float StartingPosition /* = 0.0f */, FZDOnAnimationOverrideEndSignature OnOverrideEnd /* = FZDOnAnimationOverrideEndSignature() */)
 {
 	//First make sure the slot actually exists
+	const int32 SlotIndex = GetOverrideSlotIndex(SlotName);
+	if (SlotIndex == INDEX_NONE && AnimSequence)
+	{
+		//Slot doesn't exist
+		FMessageLog PIELogger = FMessageLog(FName("PIE"));
+		PIELogger.Warning(FText::Format(LOCTEXT("InvalidOverrideSlot", "Tried to play animation override on inexistent slot '{0}'."), FText::FromName(SlotName)));
+		return FPaperZDAnimationOverrideHandle();
+	}
+
+	return PlayAnimationOverrideBySlotIndex(AnimSequence, SlotIndex, PlayRate, StartingPosition, OnOverrideEnd);
+}
+
+FPaperZDAnimationOverrideHandle UPaperZDAnimInstance::PlayAnimationOverrideBySlotIndex(const UPaperZDAnimSequence* AnimSequence, int32 SlotIndex, float PlayRate /* = 1.0f */, float StartingPosition /* = 0.0f */, FZDOnAnimationOverrideEndSignature OnOverrideEnd /* = FZDOnAnimationOverrideEndSignature() */)
+{
+	FPaperZDAnimationOverrideHandle OverrideHandle;
 	UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass());
-	if (AnimClass && AnimSequence)
+	if (AnimClass && AnimSequence && ProcessedOverrideData.IsValidIndex(SlotIndex))
 	{
-		FPaperZDOverrideSlotDescriptor SlotDescriptor;
-		if (!AnimClass->GetOverrideSlotDescriptor(SlotName, SlotDescriptor))
+		//Overrides are unique to this instance, stop sharing our animation
+		LeaveSharedAnimation();
+
+		const int32 GroupIndex = AnimClass->GetOverrideSlotGroupIndex(SlotIndex);
+		if (!AnimationOverrideHandles.IsValidIndex(GroupIndex))
 		{
-			//Slot doesn't exist
-			FMessageLog PIELogger = FMessageLog(FName("PIE"));
-			PIELogger.Warning(FText::Format(LOCTEXT("InvalidOverrideSlot", "Tried to play animation override on inexistent slot '{0}'."), FText::FromName(SlotName)));
-			return false;
+			return OverrideHandle;
 		}
 
-		//Find if there's already another slot on the same group being played (in which case it should be overridden)
-		FAnimationOverrideHandle* pHandle = AnimationOverrideHandles.FindByPredicate([&SlotDescriptor](const FAnimationOverrideHandle& Handle) -> bool { return Handle.GroupName == SlotDescriptor.GroupName; });
-		if (pHandle)
+		//If there's already another slot on the same group being played, it should be overridden
+		FAnimationOverrideHandle& Handle = AnimationOverrideHandles[GroupIndex];
+		if (Handle.IsActive())
 		{
 			//Send the "cancel" message
-			pHandle->OnOverrideEnd.ExecuteIfBound(false);
-		}
-		else
-		{
-			pHandle = &AnimationOverrideHandles.AddDefaulted_GetRef();
+			FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = MoveTemp(Handle.OnOverrideEnd);
+			Handle = FAnimationOverrideHandle();
+			OnOverrideEnd_Copy.ExecuteIfBound(false);
 		}
 
-		//Initialize the handle
-		const float StartTime = PlayRate > 0.0f ? StartingPosition : AnimSequence->GetTotalDuration() - StartingPosition;
-		pHandle->AnimSequencePtr = AnimSequence;
-		pHandle->SlotName = SlotDescriptor.SlotName;
-		pHandle->GroupName = SlotDescriptor.GroupName;
-		pHandle->PlaybackTime = FMath::Clamp(StartTime, 0.0f, AnimSequence->GetTotalDuration());
-		pHandle->PlayRate = PlayRate;
-		pHandle->OnOverrideEnd = OnOverrideEnd;
+		//Skip zero, as it marks idle groups and invalid handles
+		LastOverrideSerialNumber = LastOverrideSerialNumber == MAX_uint32 ? 1 : LastOverrideSerialNumber + 1;
 
-		return true;
+		//Initialize the handle
+		const float StartTime = PlayRate > 0.0f ? StartingPosition : AnimSequence->GetPlaybackDuration() - StartingPosition;
+		Handle.AnimSequencePtr = AnimSequence;
+		Handle.SlotIndex = SlotIndex;
+		Handle.PlaybackTime = FMath::Clamp(StartTime, 0.0f, AnimSequence->GetPlaybackDuration());
+		Handle.PlayRate = PlayRate;
+		Handle.SerialNumber = LastOverrideSerialNumber;
+		Handle.OnOverrideEnd = OnOverrideEnd;
+
+		OverrideHandle.GroupIndex = GroupIndex;
+		OverrideHandle.SerialNumber = Handle.SerialNumber;
 	}
 
-	return false;
+	return OverrideHandle;
 }
 
 void UPaperZDAnimInstance::K2_PlayAnimationOverride(const UPaperZDAnimSequence* AnimSequence, float& AnimationLength, FName SlotName /* = "DefaultSlot" */, float PlayRate /* = 1.0f */, float StartingPosition /* = 0.0f */)
@@ -301,61 +635,113 @@ void UPaperZDAnimInstance::K2_PlayAnimationOverride(const UPaperZDAnimSequence*
 	if (AnimSequence)
 	{
 		PlayAnimationOverride(AnimSequence, SlotName, PlayRate, StartingPosition);
-		AnimationLength = AnimSequence->GetTotalDuration();
+		AnimationLength = AnimSequence->GetPlaybackDuration();
 	}
 }
 
+FPaperZDAnimationOverrideHandle UPaperZDAnimInstance::K2_PlayAnimationOverrideWithHandle(const UPaperZDAnimSequence* AnimSequence, FName SlotName /* = "DefaultSlot" */, float PlayRate /* = 1.0f */, float StartingPosition /* = 0.0f */)
+{
+	return PlayAnimationOverrideWithHandle(AnimSequence, SlotName, PlayRate, StartingPosition);
+}
+
+int32 UPaperZDAnimInstance::GetOverrideSlotIndex(FName SlotName) const
+{
+	const UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass());
+	return AnimClass ? AnimClass->GetOverrideSlotIndex(SlotName) : INDEX_NONE;
+}
+
+void UPaperZDAnimInstance::StopAnimationOverride(const FPaperZDAnimationOverrideHandle& Handle)
+{
+	if (IsAnimationOverridePlaying(Handle))
+	{
+		//Cancel the override. Need to make a copy of the delegate so it triggers after it unregisters.
+		FAnimationOverrideHandle& OverrideHandle = AnimationOverrideHandles[Handle.GroupIndex];
+		FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = MoveTemp(OverrideHandle.OnOverrideEnd);
+		OverrideHandle = FAnimationOverrideHandle();
+		OnOverrideEnd_Copy.ExecuteIfBound(false);
+	}
+}
+
+bool UPaperZDAnimInstance::IsAnimationOverridePlaying(const FPaperZDAnimationOverrideHandle& Handle) const
+{
+	return Handle.IsValid() && AnimationOverrideHandles.IsValidIndex(Handle.GroupIndex) && AnimationOverrideHandles[Handle.GroupIndex].SerialNumber == Handle.SerialNumber;
+}
+
+float UPaperZDAnimInstance::GetAnimationOverridePlaybackTime(const FPaperZDAnimationOverrideHandle& Handle) const
+{
+	return IsAnimationOverridePlaying(Handle) ? AnimationOverrideHandles[Handle.GroupIndex].PlaybackTime : 0.0f;
+}
+
 bool UPaperZDAnimInstance::GetAnimationOverrideDataBySlot(FName SlotName, FPaperZDAnimationPlaybackData& OutPlaybackData) const
 {
-	const FProcessedAnimationOverrideData* pHandle = ProcessedOverrideData.FindByPredicate([SlotName](const FProcessedAnimationOverrideData& Handle) -> bool { return Handle.SlotName == SlotName; });
-	if (pHandle)
+	const FPaperZDAnimationPlaybackData* pPlaybackData = GetAnimationOverrideDataBySlotIndex(GetOverrideSlotIndex(SlotName));
+	if (pPlaybackData)
 	{
-		OutPlaybackData = pHandle->PlaybackData;
+		OutPlaybackData = *pPlaybackData;
 	}
 
-	return pHandle != nullptr;
+	return pPlaybackData != nullptr;
 }
 
 void UPaperZDAnimInstance::SetAnimationOverrideDataBySlot(FName SlotName, const FPaperZDAnimationPlaybackData& PlaybackData, bool bOverwriteExisting /* = false */)
 {
-	FProcessedAnimationOverrideData* pHandle = ProcessedOverrideData.FindByPredicate([SlotName](const FProcessedAnimationOverrideData& Handle) -> bool { return Handle.SlotName == SlotName; });
-	if (pHandle && bOverwriteExisting)
+	SetAnimationOverrideDataBySlotIndex(GetOverrideSlotIndex(SlotName), PlaybackData, bOverwriteExisting);
+}
+
+const FPaperZDAnimationPlaybackData* UPaperZDAnimInstance::GetAnimationOverrideDataBySlotIndex(int32 SlotIndex) const
+{
+	if (ProcessedOverrideData.IsValidIndex(SlotIndex) && ProcessedOverrideData[SlotIndex].bValid)
 	{
-		pHandle->PlaybackData = PlaybackData;
+		return &ProcessedOverrideData[SlotIndex].PlaybackData;
 	}
-	else
+
+	return nullptr;
+}
+
+void UPaperZDAnimInstance::SetAnimationOverrideDataBySlotIndex(int32 SlotIndex, const FPaperZDAnimationPlaybackData& PlaybackData, bool bOverwriteExisting /* = false */)
+{
+	//Only registered slots can consume the data, anything else would never be read
+	if (ProcessedOverrideData.IsValidIndex(SlotIndex))
 	{
-		FProcessedAnimationOverrideData Data;
-		Data.SlotName = SlotName;
-		Data.PlaybackData = PlaybackData;
-		ProcessedOverrideData.Add(Data);
+		FProcessedAnimationOverrideData& ProcessedData = ProcessedOverrideData[SlotIndex];
+		if (!ProcessedData.bValid || bOverwriteExisting)
+		{
+			ProcessedData.PlaybackData = PlaybackData;
+			ProcessedData.bValid = true;
+		}
 	}
 }
 
 void UPaperZDAnimInstance::StopAnimationOverrideByGroup(FName GroupToStop)
 {
-	for (int32 i = AnimationOverrideHandles.Num() - 1; i >= 0; i--)
+	UPaperZDAnimBPGeneratedClass* AnimClass = Cast<UPaperZDAnimBPGeneratedClass>(GetClass());
+	const int32 GroupIndex = AnimClass ? AnimClass->GetOverrideGroupIndex(GroupToStop) : INDEX_NONE;
+	if (AnimationOverrideHandles.IsValidIndex(GroupIndex) && AnimationOverrideHandles[GroupIndex].IsActive())
 	{
-		const FAnimationOverrideHandle& Handle = AnimationOverrideHandles[i];
-		if (Handle.GroupName == GroupToStop)
-		{
-			//Cancel the override. Need to make a copy of the delegate so it triggers after it unregisters.
-			FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = Handle.OnOverrideEnd;
-			AnimationOverrideHandles.RemoveAt(i);
-			OnOverrideEnd_Copy.ExecuteIfBound(false);
-			break;
-		}
+		//Cancel the override. Need to make a copy of the delegate so it triggers after it unregisters.
+		FAnimationOverrideHandle& Handle = AnimationOverrideHandles[GroupIndex];
+		FZDOnAnimationOverrideEndSignature OnOverrideEnd_Copy = MoveTemp(Handle.OnOverrideEnd);
+		Handle = FAnimationOverrideHandle();
+		OnOverrideEnd_Copy.ExecuteIfBound(false);
 	}
 }
 
 void UPaperZDAnimInstance::StopAllAnimationOverrides()
 {
-	//Because we want to avoid stopping any animation override added by the callbacks we might trigger, we work on a temporal copy
-	TArray<FAnimationOverrideHandle> HandleCopies = MoveTemp(AnimationOverrideHandles);
-	for (int32 i = HandleCopies.Num() - 1; i >= 0; i--)
+	//Because we want to avoid stopping any animation override added by the callbacks we might trigger, we release every handle before calling them
+	TArray<FZDOnAnimationOverrideEndSignature, TInlineAllocator<4>> OnOverrideEndCopies;
+	for (FAnimationOverrideHandle& Handle : AnimationOverrideHandles)
+	{
+		if (Handle.IsActive())
+		{
+			OnOverrideEndCopies.Add(MoveTemp(Handle.OnOverrideEnd));
+			Handle = FAnimationOverrideHandle();
+		}
+	}
+
+	for (const FZDOnAnimationOverrideEndSignature& OnOverrideEnd : OnOverrideEndCopies)
 	{
-		const FAnimationOverrideHandle& Handle = HandleCopies[i];
-		Handle.OnOverrideEnd.ExecuteIfBound(false);
+		OnOverrideEnd.ExecuteIfBound(false);
 	}
 }
 
@@ -367,7 +753,7 @@ float UPaperZDAnimInstance::GetInstanceAssetPlayerLength(int32 AssetPlayerIndex)
 		FPaperZDAnimNode_PlaySequence* AssetPlayerNode = AnimClass->GetAnimNodeByPropertyIndex<FPaperZDAnimNode_PlaySequence>(this, AssetPlayerIndex);
 		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence())
 		{
-			return AssetPlayerNode->GetAnimSequence()->GetTotalDuration();
+			return AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration();
 		}
 	}
 
@@ -395,9 +781,9 @@ float UPaperZDAnimInstance::GetInstanceAssetPlayerTimeFraction(int32 AssetPlayer
 	if (AnimClass)
 	{
 		FPaperZDAnimNode_PlaySequence* AssetPlayerNode = AnimClass->GetAnimNodeByPropertyIndex<FPaperZDAnimNode_PlaySequence>(this, AssetPlayerIndex);
-		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetTotalDuration() > 0.0f)
+		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration() > 0.0f)
 		{
-			return AssetPlayerNode->PlaybackTime / AssetPlayerNode->GetAnimSequence()->GetTotalDuration();
+			return AssetPlayerNode->PlaybackTime / AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration();
 		}
 	}
 
@@ -410,9 +796,9 @@ float UPaperZDAnimInstance::GetInstanceAssetPlayerTimeFromEnd(int32 AssetPlayerI
 	if (AnimClass)
 	{
 		FPaperZDAnimNode_PlaySequence* AssetPlayerNode = AnimClass->GetAnimNodeByPropertyIndex<FPaperZDAnimNode_PlaySequence>(this, AssetPlayerIndex);
-		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetTotalDuration() > 0.0f)
+		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration() > 0.0f)
 		{
-			return AssetPlayerNode->GetAnimSequence()->GetTotalDuration() - AssetPlayerNode->PlaybackTime;
+			return AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration() - AssetPlayerNode->PlaybackTime;
 		}
 	}
 
@@ -425,9 +811,9 @@ float UPaperZDAnimInstance::GetInstanceAssetPlayerTimeFromEndFraction(int32 Asse
 	if (AnimClass)
 	{
 		FPaperZDAnimNode_PlaySequence* AssetPlayerNode = AnimClass->GetAnimNodeByPropertyIndex<FPaperZDAnimNode_PlaySequence>(this, AssetPlayerIndex);
-		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetTotalDuration() > 0.0f)
+		if (AssetPlayerNode && AssetPlayerNode->GetAnimSequence() && AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration() > 0.0f)
 		{
-			return 1.0f - AssetPlayerNode->PlaybackTime / AssetPlayerNode->GetAnimSequence()->GetTotalDuration();
+			return 1.0f - AssetPlayerNode->PlaybackTime / AssetPlayerNode->GetAnimSequence()->GetPlaybackDuration();
 		}
 	}
 
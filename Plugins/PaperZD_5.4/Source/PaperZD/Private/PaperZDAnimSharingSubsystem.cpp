@@ -0,0 +1,189 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "PaperZDAnimSharingSubsystem.h"
+#include "PaperZDAnimInstance.h"
+#include "AnimSequences/Players/PaperZDAnimPlayer.h"
+#include "PaperZDStats.h"
+
+#if ZD_VERSION_INLINED_CPP_SUPPORT
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDAnimSharingSubsystem)
+#endif
+
+//Stats declarations
+DECLARE_CYCLE_STAT(TEXT("Animation Sharing"), STAT_AnimSharing, STATGROUP_PaperZD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Animation Sharing Buckets"), STAT_AnimSharingBuckets, STATGROUP_PaperZD);
+
+void UPaperZDAnimSharingSubsystem::Deinitialize()
+{
+	//Make sure no instance keeps pointing to a bucket that doesn't exist anymore
+	TArray<int32> BucketIndices;
+	for (TSparseArray<FSharingBucket>::TConstIterator It(Buckets); It; ++It)
+	{
+		BucketIndices.Add(It.GetIndex());
+	}
+
+	for (int32 BucketIndex : BucketIndices)
+	{
+		DissolveBucket(BucketIndex);
+	}
+
+	Super::Deinitialize();
+}
+
+void UPaperZDAnimSharingSubsystem::RegisterEvaluation(UPaperZDAnimInstance* Instance, const FPaperZDAnimSharingKey& Key, const FPaperZDAnimationPlaybackData& PlaybackData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AnimSharing);
+	check(Instance);
+
+	UPaperZDAnimInstance::FAnimationSharingState& State = Instance->SharingState;
+	if (State.BucketIndex != INDEX_NONE)
+	{
+		//We're leading a bucket, update the key it can be found with
+		FSharingBucket& Bucket = Buckets[State.BucketIndex];
+		if (!(Bucket.Key == Key))
+		{
+			if (const int32* pOldIndex = BucketsByKey.Find(Bucket.Key))
+			{
+				if (*pOldIndex == State.BucketIndex)
+				{
+					BucketsByKey.Remove(Bucket.Key);
+				}
+			}
+
+			//Another bucket reached the same frame, merge this bucket into it
+			const int32* pOtherIndex = BucketsByKey.Find(Key);
+			if (pOtherIndex && Buckets[*pOtherIndex].Leader.IsValid())
+			{
+				const int32 TargetIndex = *pOtherIndex;
+				TArray<TWeakObjectPtr<UPaperZDAnimInstance>> Members = MoveTemp(Bucket.Followers);
+				Members.Add(Instance);
+				Buckets.RemoveAt(State.BucketIndex);
+				Instance->GetPlayer()->SetRecordProcessedNotifies(false);
+				for (const TWeakObjectPtr<UPaperZDAnimInstance>& MemberPtr : Members)
+				{
+					if (UPaperZDAnimInstance* Member = MemberPtr.Get())
+					{
+						Member->SharingState.BucketIndex = INDEX_NONE;
+						Member->SharingState.bFollower = false;
+						AddFollower(TargetIndex, Member);
+					}
+				}
+
+				return;
+			}
+
+			Bucket.Key = Key;
+			BucketsByKey.Add(Key, State.BucketIndex);
+		}
+
+		//Fan out the evaluation to every follower, replaying the notifies the leader just triggered so they fire for each follower too
+		for (int32 i = Bucket.Followers.Num() - 1; i >= 0; i--)
+		{
+			UPaperZDAnimInstance* Follower = Bucket.Followers[i].Get();
+			if (Follower && Follower->GetPlayer())
+			{
+				Follower->GetPlayer()->QueueNotifiesFrom(Instance->GetPlayer(), Follower);
+				Follower->GetPlayer()->Play(PlaybackData);
+			}
+			else
+			{
+				Bucket.Followers.RemoveAtSwap(i);
+			}
+		}
+	}
+	else
+	{
+		//Not part of any bucket yet, try to find one that is playing the same frame
+		const int32* pBucketIndex = BucketsByKey.Find(Key);
+		if (pBucketIndex)
+		{
+			if (Buckets[*pBucketIndex].Leader.IsValid())
+			{
+				AddFollower(*pBucketIndex, Instance);
+				return;
+			}
+
+			//Stale bucket, its leader is gone
+			DissolveBucket(*pBucketIndex);
+		}
+
+		//Start a new bucket with us as the leader
+		FSharingBucket NewBucket;
+		NewBucket.Leader = Instance;
+		NewBucket.Key = Key;
+		State.BucketIndex = Buckets.Add(MoveTemp(NewBucket));
+		State.Subsystem = this;
+		State.bFollower = false;
+		BucketsByKey.Add(Key, State.BucketIndex);
+
+		//Followers get our notifies replayed from the copy the player keeps
+		Instance->GetPlayer()->SetRecordProcessedNotifies(true);
+	}
+
+	SET_DWORD_STAT(STAT_AnimSharingBuckets, Buckets.Num());
+}
+
+void UPaperZDAnimSharingSubsystem::RemoveInstance(UPaperZDAnimInstance* Instance)
+{
+	check(Instance);
+	UPaperZDAnimInstance::FAnimationSharingState& State = Instance->SharingState;
+	if (State.BucketIndex != INDEX_NONE && Buckets.IsValidIndex(State.BucketIndex))
+	{
+		if (State.bFollower)
+		{
+			Buckets[State.BucketIndex].Followers.RemoveSwap(Instance);
+		}
+		else
+		{
+			DissolveBucket(State.BucketIndex);
+		}
+	}
+
+	State.BucketIndex = INDEX_NONE;
+	State.bFollower = false;
+}
+
+void UPaperZDAnimSharingSubsystem::AddFollower(int32 BucketIndex, UPaperZDAnimInstance* Instance)
+{
+	Buckets[BucketIndex].Followers.Add(Instance);
+
+	UPaperZDAnimInstance::FAnimationSharingState& State = Instance->SharingState;
+	State.BucketIndex = BucketIndex;
+	State.Subsystem = this;
+	State.bFollower = true;
+	State.TimeSinceResync = 0.0f;
+}
+
+void UPaperZDAnimSharingSubsystem::DissolveBucket(int32 BucketIndex)
+{
+	FSharingBucket& Bucket = Buckets[BucketIndex];
+
+	//Release every member, followers will catch up with their own graph on their next tick
+	if (UPaperZDAnimInstance* Leader = Bucket.Leader.Get())
+	{
+		Leader->SharingState.BucketIndex = INDEX_NONE;
+		Leader->SharingState.bFollower = false;
+		if (Leader->GetPlayer())
+		{
+			Leader->GetPlayer()->SetRecordProcessedNotifies(false);
+		}
+	}
+
+	for (const TWeakObjectPtr<UPaperZDAnimInstance>& FollowerPtr : Bucket.Followers)
+	{
+		if (UPaperZDAnimInstance* Follower = FollowerPtr.Get())
+		{
+			Follower->SharingState.BucketIndex = INDEX_NONE;
+			Follower->SharingState.bFollower = false;
+		}
+	}
+
+	const int32* pKeyIndex = BucketsByKey.Find(Bucket.Key);
+	if (pKeyIndex && *pKeyIndex == BucketIndex)
+	{
+		BucketsByKey.Remove(Bucket.Key);
+	}
+
+	Buckets.RemoveAt(BucketIndex);
+	SET_DWORD_STAT(STAT_AnimSharingBuckets, Buckets.Num());
+}
@@ -0,0 +1,245 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "PaperZDDirectionalitySubsystem.h"
+#include "PaperZDAnimInstance.h"
+#include "PaperZDStats.h"
+#include "AnimSequences/PaperZDAnimSequence.h"
+#include "AnimSequences/Players/PaperZDAnimPlayer.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "Math/VectorRegister.h"
+
+#if ZD_VERSION_INLINED_CPP_SUPPORT
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDDirectionalitySubsystem)
+#endif
+
+//Stats declarations
+DECLARE_CYCLE_STAT(TEXT("Resolve Directions"), STAT_ResolveDirections, STATGROUP_PaperZD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Batched Directional Instances"), STAT_DirectionalInstances, STATGROUP_PaperZD);
+
+namespace ZD
+{
+	/* Amount of entries processed by each SIMD iteration. */
+	static constexpr int32 DirectionBatchWidth = 4;
+
+	/* Projects the world direction into the 2D plane used by the directional sequences, where 'top' is the Y axis. */
+	static FVector2D ProjectDirection(const FVector& Direction, EPaperZDDirectionPlane Plane)
+	{
+		//Top-down games look along -Z with X pointing to the top of the screen, side scrollers look along Y with Z up
+		return Plane == EPaperZDDirectionPlane::TopDown ? FVector2D(Direction.Y, Direction.X) : FVector2D(Direction.X, Direction.Z);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// FPaperZDDirectionalityTickFunction
+//////////////////////////////////////////////////////////////////////////
+void FPaperZDDirectionalityTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->ResolveDirections();
+	}
+}
+
+FString FPaperZDDirectionalityTickFunction::DiagnosticMessage()
+{
+	return TEXT("FPaperZDDirectionalityTickFunction");
+}
+
+FName FPaperZDDirectionalityTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("PaperZDDirectionality"));
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// UPaperZDDirectionalitySubsystem
+//////////////////////////////////////////////////////////////////////////
+void UPaperZDDirectionalitySubsystem::PostInitialize()
+{
+	Super::PostInitialize();
+
+	//Movement runs on the pre-physics group, resolve once it (and physics) are done
+	UWorld* World = GetWorld();
+	if (World && World->PersistentLevel)
+	{
+		TickFunction.Subsystem = this;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = true;
+		TickFunction.TickGroup = TG_PostPhysics;
+		TickFunction.EndTickGroup = TG_PostPhysics;
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+}
+
+void UPaperZDDirectionalitySubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	TickFunction.Subsystem = nullptr;
+
+	for (const TWeakObjectPtr<UPaperZDAnimInstance>& InstancePtr : Instances)
+	{
+		if (UPaperZDAnimInstance* Instance = InstancePtr.Get())
+		{
+			Instance->DirectionalityState.EntryIndex = INDEX_NONE;
+			Instance->DirectionalityState.Subsystem.Reset();
+		}
+	}
+
+	Instances.Empty();
+	Super::Deinitialize();
+}
+
+void UPaperZDDirectionalitySubsystem::RegisterInstance(UPaperZDAnimInstance* Instance)
+{
+	check(Instance);
+	if (Instance->DirectionalityState.EntryIndex == INDEX_NONE)
+	{
+		Instance->DirectionalityState.EntryIndex = Instances.Add(Instance);
+		Instance->DirectionalityState.Subsystem = this;
+	}
+}
+
+void UPaperZDDirectionalitySubsystem::UnregisterInstance(UPaperZDAnimInstance* Instance)
+{
+	check(Instance);
+	const int32 EntryIndex = Instance->DirectionalityState.EntryIndex;
+	if (Instances.IsValidIndex(EntryIndex) && Instances[EntryIndex].Get() == Instance)
+	{
+		RemoveEntryAt(EntryIndex);
+	}
+
+	Instance->DirectionalityState.EntryIndex = INDEX_NONE;
+	Instance->DirectionalityState.Subsystem.Reset();
+}
+
+void UPaperZDDirectionalitySubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+	Instances.RemoveAtSwap(EntryIndex);
+	if (Instances.IsValidIndex(EntryIndex))
+	{
+		if (UPaperZDAnimInstance* Moved = Instances[EntryIndex].Get())
+		{
+			Moved->DirectionalityState.EntryIndex = EntryIndex;
+		}
+	}
+}
+
+void UPaperZDDirectionalitySubsystem::ResolveDirections()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ResolveDirections);
+
+	//Drop the instances that were garbage collected
+	for (int32 i = Instances.Num() - 1; i >= 0; i--)
+	{
+		if (!Instances[i].IsValid())
+		{
+			RemoveEntryAt(i);
+		}
+	}
+
+	const int32 NumEntries = Instances.Num();
+	SET_DWORD_STAT(STAT_DirectionalInstances, NumEntries);
+	if (NumEntries == 0)
+	{
+		return;
+	}
+
+	//Gather the directions into contiguous arrays, padded so the batch can always process full registers
+	const int32 PaddedNum = Align(NumEntries, ZD::DirectionBatchWidth);
+	InputX.SetNumUninitialized(PaddedNum);
+	InputY.SetNumUninitialized(PaddedNum);
+	InvSectorSizes.SetNumUninitialized(PaddedNum);
+	AngleOffsets.SetNumUninitialized(PaddedNum);
+	SectorBiases.SetNumUninitialized(PaddedNum);
+	NumSectors.SetNumUninitialized(PaddedNum);
+	Angles.SetNumUninitialized(PaddedNum);
+	RawSectors.SetNumUninitialized(PaddedNum);
+
+	for (int32 i = 0; i < PaddedNum; i++)
+	{
+		FVector2D Direction = FVector2D::ZeroVector;
+		int32 EntrySectors = 1;
+		float AngleOffset = 0.0f;
+		if (i < NumEntries)
+		{
+			//Match the directions of the sequence being played, so the resolved sector is one the sequence actually has
+			const UPaperZDAnimInstance* Instance = Instances[i].Get();
+			const UPaperZDAnimSequence* Sequence = Instance->GetPlayer() ? Instance->GetPlayer()->GetCurrentAnimSequence() : nullptr;
+			if (Sequence && Sequence->IsDirectionalSequence())
+			{
+				EntrySectors = Sequence->GetNumDirections();
+				AngleOffset = Sequence->GetDirectionalAngleOffset();
+			}
+			else
+			{
+				EntrySectors = FMath::Max(Instance->DirectionalSectors, 1);
+			}
+
+			if (const AActor* Actor = Instance->GetOwningActor())
+			{
+				//Prefer the movement direction, falling back to the facing of the actor when standing still
+				Direction = ZD::ProjectDirection(Actor->GetVelocity(), Instance->DirectionalPlane);
+				if (Direction.SizeSquared() < FMath::Square(Instance->DirectionalMinSpeed))
+				{
+					Direction = ZD::ProjectDirection(Actor->GetActorForwardVector(), Instance->DirectionalPlane);
+				}
+			}
+		}
+
+		const float SectorSize = 360.0f / EntrySectors;
+		InputX[i] = (float)Direction.X;
+		InputY[i] = (float)Direction.Y;
+		NumSectors[i] = EntrySectors;
+		InvSectorSizes[i] = 1.0f / SectorSize;
+		AngleOffsets[i] = AngleOffset;
+		SectorBiases[i] = AngleOffset + SectorSize * 0.5f + 360.0f;
+	}
+
+	//Angle against the top of the plane, positive to the right (same convention as the SetDirectionality node), and the sector it falls in
+	const VectorRegister4Float RadToDeg = VectorSetFloat1(180.0f / UE_PI);
+	for (int32 i = 0; i < PaddedNum; i += ZD::DirectionBatchWidth)
+	{
+		const VectorRegister4Float X = VectorLoad(&InputX[i]);
+		const VectorRegister4Float Y = VectorLoad(&InputY[i]);
+		const VectorRegister4Float Degrees = VectorMultiply(VectorATan2(X, Y), RadToDeg);
+		const VectorRegister4Float Biased = VectorAdd(Degrees, VectorLoad(&SectorBiases[i]));
+		VectorStore(Degrees, &Angles[i]);
+		VectorStore(VectorFloor(VectorMultiply(Biased, VectorLoad(&InvSectorSizes[i]))), &RawSectors[i]);
+	}
+
+	//Stabilize the sectors and write them into the instances
+	for (int32 i = 0; i < NumEntries; i++)
+	{
+		UPaperZDAnimInstance* Instance = Instances[i].Get();
+		UPaperZDAnimInstance::FDirectionalityState& State = Instance->DirectionalityState;
+
+		//Without any direction to go by, keep whatever sector we were facing
+		if (InputX[i] == 0.0f && InputY[i] == 0.0f)
+		{
+			continue;
+		}
+
+		const int32 EntrySectors = NumSectors[i];
+		const float SectorSize = 360.0f / EntrySectors;
+		int32 Sector = (int32)RawSectors[i] % EntrySectors;
+
+		//Stay on the previous sector until the angle leaves it by more than the hysteresis margin, avoids flickering when moving along a boundary
+		//A sector resolved with a different amount of directions doesn't say anything about the current one
+		if (State.Sector != INDEX_NONE && State.NumSectors == EntrySectors && Sector != State.Sector)
+		{
+			const float DeltaFromPrevious = FMath::Abs(FMath::FindDeltaAngleDegrees(State.Sector * SectorSize - AngleOffsets[i], Angles[i]));
+			if (DeltaFromPrevious <= SectorSize * 0.5f + Instance->DirectionalHysteresis)
+			{
+				Sector = State.Sector;
+			}
+		}
+
+		State.Sector = Sector;
+		State.NumSectors = EntrySectors;
+		State.Angle = FMath::UnwindDegrees(Sector * SectorSize - AngleOffsets[i]);
+	}
+}
@@ -0,0 +1,152 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "PaperZDSimplePlayerComponent.h"
+#include "PaperZDSimplePlayerSubsystem.h"
+#include "AnimSequences/PaperZDAnimSequence.h"
+#include "Components/PrimitiveComponent.h"
+
+#if ZD_VERSION_INLINED_CPP_SUPPORT
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDSimplePlayerComponent)
+#endif
+
+UPaperZDSimplePlayerComponent::UPaperZDSimplePlayerComponent()
+	: AnimSequence(nullptr)
+	, bLooping(true)
+	, PlayRate(1.0f)
+	, bRandomStartTime(true)
+	, bPlayOnBeginPlay(true)
+	, DirectionalAngle(0.0f)
+	, bOnlyUpdateWhenRendered(true)
+	, EntryIndex(INDEX_NONE)
+	, CurrentRandomEntryIndex(INDEX_NONE)
+{
+	//Playback is driven by the simple player subsystem
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UPaperZDSimplePlayerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bPlayOnBeginPlay)
+	{
+		Play();
+	}
+}
+
+void UPaperZDSimplePlayerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Stop();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPaperZDSimplePlayerComponent::Play()
+{
+	if (UPaperZDSimplePlayerSubsystem* Subsystem = UPaperZDSimplePlayerSubsystem::Get(this))
+	{
+		Subsystem->AddPlayer(this);
+	}
+}
+
+void UPaperZDSimplePlayerComponent::Stop()
+{
+	if (IsPlaying())
+	{
+		if (UPaperZDSimplePlayerSubsystem* Subsystem = UPaperZDSimplePlayerSubsystem::Get(this))
+		{
+			Subsystem->RemovePlayer(this);
+		}
+
+		EntryIndex = INDEX_NONE;
+	}
+}
+
+void UPaperZDSimplePlayerComponent::SetAnimSequence(UPaperZDAnimSequence* InAnimSequence)
+{
+	AnimSequence = InAnimSequence;
+	RandomEntries.Empty();
+	CurrentRandomEntryIndex = INDEX_NONE;
+
+	if (IsPlaying())
+	{
+		Play();
+	}
+}
+
+void UPaperZDSimplePlayerComponent::SetDirectionalAngle(float InDirectionalAngle)
+{
+	DirectionalAngle = InDirectionalAngle;
+}
+
+float UPaperZDSimplePlayerComponent::GetPlaybackTime() const
+{
+	const UPaperZDSimplePlayerSubsystem* Subsystem = IsPlaying() ? UPaperZDSimplePlayerSubsystem::Get(this) : nullptr;
+	return Subsystem ? Subsystem->GetPlaybackTime(EntryIndex) : 0.0f;
+}
+
+UPaperZDAnimSequence* UPaperZDSimplePlayerComponent::GetCurrentAnimSequence() const
+{
+	if (UsesRandomEntries())
+	{
+		return RandomEntries.IsValidIndex(CurrentRandomEntryIndex) ? RandomEntries[CurrentRandomEntryIndex].AnimSequence : nullptr;
+	}
+
+	return AnimSequence;
+}
+
+UPrimitiveComponent* UPaperZDSimplePlayerComponent::GetRenderComponent() const
+{
+	return Cast<UPrimitiveComponent>(RenderComponentRef.GetComponent(GetOwner()));
+}
+
+void UPaperZDSimplePlayerComponent::InitRenderComponent(UPrimitiveComponent* InRenderComponent)
+{
+	RenderComponentRef.PathToComponent = InRenderComponent ? InRenderComponent->GetPathName(GetOwner()) : FString();
+}
+
+bool UPaperZDSimplePlayerComponent::UsesRandomEntries() const
+{
+	return RandomEntries.Num() > 0;
+}
+
+bool UPaperZDSimplePlayerComponent::PickRandomEntry(float& OutPlayRate, int32& OutLoops)
+{
+	//Select a random number that falls in between the universe of "chance" we have, then search which entry got it
+	float AggregatedChance = 0.0f;
+	for (const FPaperZDRandomPlayerEntry& Entry : RandomEntries)
+	{
+		AggregatedChance += Entry.AnimSequence ? Entry.ChanceToPlay : 0.0f;
+	}
+
+	const float RandResult = FMath::RandRange(0.0f, AggregatedChance);
+	float CurrentChance = 0.0f;
+	CurrentRandomEntryIndex = INDEX_NONE;
+	for (int32 i = 0; i < RandomEntries.Num(); i++)
+	{
+		if (RandomEntries[i].AnimSequence)
+		{
+			CurrentRandomEntryIndex = i;
+			CurrentChance += RandomEntries[i].ChanceToPlay;
+			if (CurrentChance >= RandResult)
+			{
+				break;
+			}
+		}
+	}
+
+	if (CurrentRandomEntryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	//Initialize the entry the same way the random player node does
+	const FPaperZDRandomPlayerEntry& Entry = RandomEntries[CurrentRandomEntryIndex];
+	OutLoops = FMath::RandRange(Entry.MinLoopCount, Entry.MaxLoopCount);
+	OutPlayRate = FMath::RandRange(Entry.MinPlayRate, Entry.MaxPlayRate);
+	if (OutPlayRate == 0.0f)
+	{
+		OutPlayRate = Entry.MinPlayRate != 0.0f ? Entry.MinPlayRate : Entry.MaxPlayRate;
+	}
+
+	return true;
+}
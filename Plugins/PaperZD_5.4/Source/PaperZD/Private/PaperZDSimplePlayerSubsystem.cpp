@@ -0,0 +1,283 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "PaperZDSimplePlayerSubsystem.h"
+#include "PaperZDSimplePlayerComponent.h"
+#include "PaperZDStats.h"
+#include "AnimSequences/PaperZDAnimSequence.h"
+#include "AnimSequences/Sources/PaperZDAnimationSource.h"
+#include "AnimSequences/Players/PaperZDPlaybackHandle.h"
+#include "AnimSequences/Players/PaperZDAnimationPlaybackData.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+#if ZD_VERSION_INLINED_CPP_SUPPORT
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDSimplePlayerSubsystem)
+#endif
+
+//Stats declarations
+DECLARE_CYCLE_STAT(TEXT("Simple Player Update"), STAT_SimplePlayerUpdate, STATGROUP_PaperZD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Simple Players"), STAT_SimplePlayers, STATGROUP_PaperZD);
+
+namespace ZD
+{
+	/* Time after the last render in which a component is still considered visible. */
+	static constexpr float SimplePlayerRecentlyRenderedTime = 0.2f;
+}
+
+UPaperZDSimplePlayerSubsystem* UPaperZDSimplePlayerSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPaperZDSimplePlayerSubsystem>() : nullptr;
+}
+
+void UPaperZDSimplePlayerSubsystem::Deinitialize()
+{
+	for (const TWeakObjectPtr<UPaperZDSimplePlayerComponent>& PlayerPtr : Players)
+	{
+		if (UPaperZDSimplePlayerComponent* Player = PlayerPtr.Get())
+		{
+			Player->EntryIndex = INDEX_NONE;
+		}
+	}
+
+	Players.Empty();
+	RenderComponents.Empty();
+	Sequences.Empty();
+	Handles.Empty();
+	PlaybackTimes.Empty();
+	PlayRates.Empty();
+	Durations.Empty();
+	RemainingLoops.Empty();
+	EndBehaviors.Empty();
+	SharedHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPaperZDSimplePlayerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const int32 NumEntries = Players.Num();
+	SET_DWORD_STAT(STAT_SimplePlayers, NumEntries);
+	if (NumEntries == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SimplePlayerUpdate);
+
+	//Advance every player at once
+	float* RESTRICT Times = PlaybackTimes.GetData();
+	const float* RESTRICT Rates = PlayRates.GetData();
+	for (int32 i = 0; i < NumEntries; i++)
+	{
+		Times[i] += DeltaTime * Rates[i];
+	}
+
+	//Handle the players that reached either end of their sequence and render, backwards so stale entries can be removed on the way
+	for (int32 i = NumEntries - 1; i >= 0; i--)
+	{
+		if (!Players[i].IsValid())
+		{
+			RemoveEntryAt(i);
+			continue;
+		}
+
+		const float Duration = Durations[i];
+		float& Time = PlaybackTimes[i];
+		if (Time > Duration || Time < 0.0f)
+		{
+			bool bWrap = true;
+			if (EndBehaviors[i] == EEndBehavior::Stop)
+			{
+				Time = FMath::Clamp(Time, 0.0f, Duration);
+				PlayRates[i] = 0.0f;
+				bWrap = false;
+			}
+			else if (EndBehaviors[i] == EEndBehavior::PickRandom && --RemainingLoops[i] < 0)
+			{
+				//Done with this entry, jump to the next one
+				if (!StartEntry(i, false))
+				{
+					RemoveEntryAt(i);
+					continue;
+				}
+
+				bWrap = false;
+			}
+
+			if (bWrap)
+			{
+				Time = Duration > 0.0f ? FMath::Fmod(Time, Duration) : 0.0f;
+				Time = Time < 0.0f ? Time + Duration : Time;
+			}
+		}
+
+		RenderEntry(i);
+	}
+}
+
+TStatId UPaperZDSimplePlayerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPaperZDSimplePlayerSubsystem, STATGROUP_PaperZD);
+}
+
+void UPaperZDSimplePlayerSubsystem::AddPlayer(UPaperZDSimplePlayerComponent* Player)
+{
+	check(Player);
+
+	int32 EntryIndex = Player->EntryIndex;
+	if (!Players.IsValidIndex(EntryIndex) || Players[EntryIndex].Get() != Player)
+	{
+		EntryIndex = Players.Add(Player);
+		RenderComponents.AddDefaulted();
+		Sequences.Add(nullptr);
+		Handles.Add(nullptr);
+		PlaybackTimes.Add(0.0f);
+		PlayRates.Add(0.0f);
+		Durations.Add(0.0f);
+		RemainingLoops.Add(0);
+		EndBehaviors.Add(EEndBehavior::Loop);
+		Player->EntryIndex = EntryIndex;
+	}
+
+	if (StartEntry(EntryIndex, true))
+	{
+		//Render right away, so the first frame doesn't show whatever the component had
+		RenderEntry(EntryIndex, true);
+	}
+	else
+	{
+		RemoveEntryAt(EntryIndex);
+		Player->EntryIndex = INDEX_NONE;
+	}
+}
+
+void UPaperZDSimplePlayerSubsystem::RemovePlayer(UPaperZDSimplePlayerComponent* Player)
+{
+	check(Player);
+	const int32 EntryIndex = Player->EntryIndex;
+	if (Players.IsValidIndex(EntryIndex) && Players[EntryIndex].Get() == Player)
+	{
+		RemoveEntryAt(EntryIndex);
+	}
+
+	Player->EntryIndex = INDEX_NONE;
+}
+
+bool UPaperZDSimplePlayerSubsystem::StartEntry(int32 EntryIndex, bool bRestart)
+{
+	UPaperZDSimplePlayerComponent* Player = Players[EntryIndex].Get();
+	if (!Player)
+	{
+		return false;
+	}
+
+	//Select what to play
+	float PlayRate = Player->PlayRate;
+	int32 Loops = 0;
+	EEndBehavior EndBehavior = Player->bLooping ? EEndBehavior::Loop : EEndBehavior::Stop;
+	if (Player->UsesRandomEntries())
+	{
+		if (!Player->PickRandomEntry(PlayRate, Loops))
+		{
+			return false;
+		}
+
+		EndBehavior = EEndBehavior::PickRandom;
+	}
+
+	const UPaperZDAnimSequence* Sequence = Player->GetCurrentAnimSequence();
+	UPaperZDPlaybackHandle* Handle = Sequence ? GetOrCreateHandle(Sequence->GetAnimSource()) : nullptr;
+	if (!Handle)
+	{
+		return false;
+	}
+
+	//The render component only needs to be configured once, but the handle could change with the sequence
+	UPrimitiveComponent* RenderComponent = Player->GetRenderComponent();
+	if (bRestart || Handles[EntryIndex] != Handle || RenderComponents[EntryIndex].Get() != RenderComponent)
+	{
+		if (RenderComponent)
+		{
+			Handle->ConfigureRenderComponent(RenderComponent);
+		}
+	}
+
+	const float Duration = Sequence->GetPlaybackDuration();
+	float StartTime = PlayRate < 0.0f ? Duration : 0.0f;
+	if (bRestart && Player->bRandomStartTime)
+	{
+		StartTime = FMath::FRand() * Duration;
+	}
+
+	RenderComponents[EntryIndex] = RenderComponent;
+	Sequences[EntryIndex] = Sequence;
+	Handles[EntryIndex] = Handle;
+	PlaybackTimes[EntryIndex] = StartTime;
+	PlayRates[EntryIndex] = PlayRate;
+	Durations[EntryIndex] = Duration;
+	RemainingLoops[EntryIndex] = Loops;
+	EndBehaviors[EntryIndex] = EndBehavior;
+	return true;
+}
+
+void UPaperZDSimplePlayerSubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+	Players.RemoveAtSwap(EntryIndex);
+	RenderComponents.RemoveAtSwap(EntryIndex);
+	Sequences.RemoveAtSwap(EntryIndex);
+	Handles.RemoveAtSwap(EntryIndex);
+	PlaybackTimes.RemoveAtSwap(EntryIndex);
+	PlayRates.RemoveAtSwap(EntryIndex);
+	Durations.RemoveAtSwap(EntryIndex);
+	RemainingLoops.RemoveAtSwap(EntryIndex);
+	EndBehaviors.RemoveAtSwap(EntryIndex);
+
+	if (Players.IsValidIndex(EntryIndex))
+	{
+		if (UPaperZDSimplePlayerComponent* Moved = Players[EntryIndex].Get())
+		{
+			Moved->EntryIndex = EntryIndex;
+		}
+	}
+}
+
+UPaperZDPlaybackHandle* UPaperZDSimplePlayerSubsystem::GetOrCreateHandle(UPaperZDAnimationSource* AnimSource)
+{
+	if (!AnimSource || !AnimSource->GetPlaybackHandleClass())
+	{
+		return nullptr;
+	}
+
+	TObjectPtr<UPaperZDPlaybackHandle>& Handle = SharedHandles.FindOrAdd(AnimSource);
+	if (!Handle)
+	{
+		Handle = NewObject<UPaperZDPlaybackHandle>(this, AnimSource->GetPlaybackHandleClass());
+		AnimSource->InitPlaybackHandle(Handle);
+	}
+
+	return Handle;
+}
+
+void UPaperZDSimplePlayerSubsystem::RenderEntry(int32 EntryIndex, bool bForce /* = false */)
+{
+	UPrimitiveComponent* RenderComponent = RenderComponents[EntryIndex].Get();
+	const UPaperZDSimplePlayerComponent* Player = Players[EntryIndex].Get();
+	if (!RenderComponent || !Player)
+	{
+		return;
+	}
+
+	//Background actors off-screen only need their time to keep advancing
+	if (!bForce && Player->bOnlyUpdateWhenRendered && RenderComponent->IsRegistered() && !RenderComponent->WasRecentlyRendered(ZD::SimplePlayerRecentlyRenderedTime))
+	{
+		return;
+	}
+
+	FPaperZDAnimationPlaybackData PlaybackData;
+	PlaybackData.SetAnimation(Sequences[EntryIndex], PlaybackTimes[EntryIndex]);
+	PlaybackData.DirectionalAngle = Player->DirectionalAngle;
+	Handles[EntryIndex]->UpdateRenderPlayback(RenderComponent, PlaybackData);
+}
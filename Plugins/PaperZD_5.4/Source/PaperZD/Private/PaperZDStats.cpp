@@ -0,0 +1,19 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "PaperZDStats.h"
+
+bool FPaperZDRuntimePhaseTimings::bEnabled = false;
+uint64 FPaperZDRuntimePhaseTimings::Cycles[(int32)EPaperZDRuntimePhase::Num] = {};
+
+void FPaperZDRuntimePhaseTimings::Reset()
+{
+	for (uint64& PhaseCycles : Cycles)
+	{
+		PhaseCycles = 0;
+	}
+}
+
+double FPaperZDRuntimePhaseTimings::GetMilliseconds(EPaperZDRuntimePhase Phase)
+{
+	return FPlatformTime::ToMilliseconds64(Cycles[(int32)Phase]);
+}
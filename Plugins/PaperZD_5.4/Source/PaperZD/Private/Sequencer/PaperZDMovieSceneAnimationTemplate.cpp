@@ -6,13 +6,20 @@
 #include "AnimSequences/Players/PaperZDAnimationPlaybackData.h"
 #include "AnimSequences/Players/PaperZDAnimPlayer.h"
 #include "PaperZDAnimInstance.h"
+#include "PaperZDStats.h"
 #include "IMovieScenePlayer.h"
+#include "Evaluation/MovieSceneExecutionTokens.h"
+#include "Evaluation/PersistentEvaluationData.h"
 #include "Engine/World.h"
 
 #if ZD_VERSION_INLINED_CPP_SUPPORT
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDMovieSceneAnimationTemplate)
 #endif
 
+//Stats declarations
+DECLARE_CYCLE_STAT(TEXT("Sequencer Batch Apply"), STAT_SequencerBatchApply, STATGROUP_PaperZD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sequencer Batched Instances"), STAT_SequencerBatchedInstances, STATGROUP_PaperZD);
+
 namespace FPaperZDMovieSceneHelpers
 {
 	bool ShouldUsePreviewPlayback(IMovieScenePlayer& Player, UObject& RuntimeObject)
@@ -109,6 +116,155 @@ namespace ZD
 		}
 	};
 
+	/**
+	 * Every PaperZD animation evaluated by a sequence player, gathered in a single flat list so they can be applied in one pass after all the tracks have been blended.
+	 * The batch lives on the persistent data of the player that evaluates it, so players and worlds never see each other's instances, and it is emptied by the shared flush token of the same evaluation.
+	 * Its buffers are kept between evaluations so they get reused.
+	 */
+	struct FSequencerAnimationBatch : IPersistentEvaluationData
+	{
+	private:
+		/* A single animation to apply, with its sequence already resolved. */
+		struct FBatchedAnimation
+		{
+			const UPaperZDAnimSequence* Sequence;
+			float PreviousEvalTime;
+			float EvalTime;
+			float Weight;
+			FName SlotName;
+		};
+
+		/* An AnimInstance animated by the sequence, along with the range of animations that target it. */
+		struct FBatchedInstance
+		{
+			UPaperZDAnimInstance* AnimInstance;
+			int32 FirstAnimation;
+			int32 NumAnimations;
+			bool bFireNotifies;
+			bool bPreviewPlayback;
+		};
+
+		TArray<FBatchedAnimation> Animations;
+		TArray<FBatchedInstance> Instances;
+
+		/* Playback data for each override slot index of the instance being applied. */
+		TArray<TPair<int32, FPaperZDAnimationPlaybackData>, TInlineAllocator<2>> SlotPlaybackData;
+
+	public:
+		/* Obtain the batch of the player owning the given persistent data. */
+		static FSequencerAnimationBatch& Get(FPersistentEvaluationData& PersistentData)
+		{
+			return PersistentData.GetOrAdd<FSequencerAnimationBatch>(GetSharedDataKey());
+		}
+
+		/* Obtain the key the batch is stored with, one per player. */
+		static FSharedPersistentDataKey GetSharedDataKey()
+		{
+			static FMovieSceneSharedDataId ID = FMovieSceneSharedDataId::Allocate();
+			return FSharedPersistentDataKey(ID, FMovieSceneEvaluationOperand(MovieSceneSequenceID::Root, FGuid()));
+		}
+
+		/* Queues the blended animations of the given instance. */
+		void Add(UPaperZDAnimInstance* AnimInstance, const FBlendedAnimation& BlendedAnimation, bool bFireNotifies, bool bPreviewPlayback)
+		{
+			FBatchedInstance& Instance = Instances.AddDefaulted_GetRef();
+			Instance.AnimInstance = AnimInstance;
+			Instance.FirstAnimation = Animations.Num();
+			Instance.NumAnimations = 0;
+			Instance.bFireNotifies = bFireNotifies;
+			Instance.bPreviewPlayback = bPreviewPlayback;
+
+			for (const FMinimalAnimParameters& Params : BlendedAnimation.Animations)
+			{
+				if (const UPaperZDAnimSequence* Sequence = Params.SequencePtr.Get())
+				{
+					Animations.Add({ Sequence, Params.PreviousEvalTime, Params.EvalTime, Params.Weight, Params.SlotName });
+					Instance.NumAnimations++;
+				}
+			}
+		}
+
+		/* Applies every queued animation and empties the batch. */
+		void Flush()
+		{
+			if (Instances.Num() == 0)
+			{
+				return;
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_SequencerBatchApply);
+			INC_DWORD_STAT_BY(STAT_SequencerBatchedInstances, Instances.Num());
+
+			for (const FBatchedInstance& Instance : Instances)
+			{
+				UPaperZDAnimInstance* AnimInstance = Instance.AnimInstance;
+
+				//Build the playback data of every slot
+				SlotPlaybackData.Reset();
+				for (int32 i = Instance.FirstAnimation; i < Instance.FirstAnimation + Instance.NumAnimations; i++)
+				{
+					const FBatchedAnimation& Animation = Animations[i];
+					const int32 SlotIndex = AnimInstance->GetOverrideSlotIndex(Animation.SlotName);
+					if (SlotIndex == INDEX_NONE)
+					{
+						continue;
+					}
+
+					TPair<int32, FPaperZDAnimationPlaybackData>* pSlotData = SlotPlaybackData.FindByPredicate([SlotIndex](const TPair<int32, FPaperZDAnimationPlaybackData>& Pair) { return Pair.Key == SlotIndex; });
+					if (!pSlotData)
+					{
+						pSlotData = &SlotPlaybackData.Emplace_GetRef(SlotIndex, FPaperZDAnimationPlaybackData());
+					}
+					pSlotData->Value.AddAnimation(Animation.Sequence, Animation.EvalTime, Animation.Weight);
+				}
+
+				//Process the notifies if needed
+				if (Instance.bFireNotifies)
+				{
+					for (int32 i = Instance.FirstAnimation; i < Instance.FirstAnimation + Instance.NumAnimations; i++)
+					{
+						const FBatchedAnimation& Animation = Animations[i];
+						const float DeltaTime = Animation.EvalTime - Animation.PreviousEvalTime;
+						AnimInstance->GetPlayer()->ProcessAnimSequenceNotifies(Animation.Sequence, DeltaTime, Animation.EvalTime, Animation.PreviousEvalTime, Animation.Weight, AnimInstance);
+					}
+				}
+
+				//We want Sequencer animations to have more priority than any AnimationOverride the user might have triggered so we will override them if needed
+				for (const TPair<int32, FPaperZDAnimationPlaybackData>& SlotData : SlotPlaybackData)
+				{
+					AnimInstance->SetAnimationOverrideDataBySlotIndex(SlotData.Key, SlotData.Value, true);
+				}
+
+				//If we're on a preview playback, we need to force the animation blueprint to do a 'virtual tick' so we can process the animations and render them correctly
+				if (Instance.bPreviewPlayback)
+				{
+					AnimInstance->UpdateSequencerPreview();
+				}
+			}
+
+			Animations.Reset();
+			Instances.Reset();
+		}
+	};
+
+	/* Shared token that applies the animation batch of the player once all the actuators have run. */
+	struct FFlushAnimationBatchToken : IMovieSceneSharedExecutionToken
+	{
+		static FMovieSceneSharedDataId GetSharedDataID()
+		{
+			static FMovieSceneSharedDataId ID = FMovieSceneSharedDataId::Allocate();
+			return ID;
+		}
+
+		virtual void Execute(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
+		{
+			if (FSequencerAnimationBatch* Batch = PersistentData.Find<FSequencerAnimationBatch>(FSequencerAnimationBatch::GetSharedDataKey()))
+			{
+				Batch->Flush();
+			}
+		}
+	};
+
 	//Actuator which mixes the animation onto the final playback data
 	struct FPaperZDAnimationActuator : TMovieSceneBlendingActuator<FBlendedAnimation>
 	{
@@ -137,7 +293,7 @@ namespace ZD
 			return FBlendedAnimation();
 		}
 
-		/* Apply the animation data. */
+		/* Queue the animation data, applied in a batch with every other animated object once the blending is done. */
 		virtual void Actuate(UObject* InObject, const FBlendedAnimation& InFinalValue, const TBlendableTokenStack<FBlendedAnimation>& OriginalStack, const FMovieSceneContext& Context, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 		{
 			//The object should always conform to the sequencer source interface
@@ -154,35 +310,7 @@ namespace ZD
 
 				// If the playback status is jumping, ie. one such occurrence is setting the time for thumbnail generation, disable anim notifies updates because it could fire audio
  				const bool bFireNotifies = !bPreviewPlayback || (PlayerStatus != EMovieScenePlayerStatus::Jumping && PlayerStatus != EMovieScenePlayerStatus::Stopped);
-				
-				//Start collecting the animations into the final playback data structure
-				TMap<FName, FPaperZDAnimationPlaybackData> PlaybackDataMap;
-				for (const FMinimalAnimParameters& Params : InFinalValue.Animations)
-				{
-					//Process the notifies if needed
-					if (bFireNotifies)
-					{
-						const float DeltaTime = Params.EvalTime - Params.PreviousEvalTime;
-						AnimInstance->GetPlayer()->ProcessAnimSequenceNotifies(Params.SequencePtr.Get(), DeltaTime, Params.EvalTime, Params.PreviousEvalTime, Params.Weight, AnimInstance);
-					}
-
-					//Obtain the playback handle for the slot
-					FPaperZDAnimationPlaybackData& PlaybackData = PlaybackDataMap.FindOrAdd(Params.SlotName);
-					PlaybackData.AddAnimation(Params.SequencePtr.Get(), Params.EvalTime, Params.Weight);
-				}
-
-				//Now that we have all the animation pertaining to each slot, apply to the AnimInstance
-				//we want Sequencer animations to have more priority than any AnimationOverride the user might have triggered so we will override them if needed
-				for (TPair<FName, FPaperZDAnimationPlaybackData> KVPair : PlaybackDataMap)
-				{
-					AnimInstance->SetAnimationOverrideDataBySlot(KVPair.Key, KVPair.Value, true);
-				}
-
-				//If we're on a preview playback, we need to force the animation blueprint to do a 'virtual tick' so we can process the animations and render them correctly
-				if (bPreviewPlayback)
-				{
-					AnimInstance->UpdateSequencerPreview();
-				}
+				FSequencerAnimationBatch::Get(PersistentData).Add(AnimInstance, InFinalValue, bFireNotifies, bPreviewPlayback);
 			}
 		}
 	};
@@ -215,6 +343,9 @@ void FPaperZDMovieSceneAnimationTemplate::Evaluate(const FMovieSceneEvaluationOp
 		Accumulator.DefineActuator(ActuatorTypeID, MakeShared<ZD::FPaperZDAnimationActuator>());
 	}
 
+	//Shared tokens run after the blending, flushing the batch once for every PaperZD track on this sequence
+	ExecutionTokens.AddShared(ZD::FFlushAnimationBatchToken::GetSharedDataID(), ZD::FFlushAnimationBatchToken());
+
 	// calculate the time at which to evaluate the animation
 	float EvalTime = Params.MapTimeToAnimation(Context.GetTime(),Context.GetFrameRate(), Params.Animation);
 	float PreviousEvalTime = Params.MapTimeToAnimation(Context.GetPreviousTime(), Context.GetFrameRate(), Params.Animation);
@@ -20,6 +20,10 @@ struct PAPERZD_API FPaperZDAnimNode_LayerAnimations : public FPaperZDAnimNode_Ba
 	UPROPERTY(EditAnywhere, EditFixedSize, Category = "Input", meta = (ShowPinByDefault, UIMin = "0.0", ClampMin = "0.0", UIMax = "1.0", ClampMax = "1.0"))
 	TArray<float> LayerWeight;
 
+private:
+	/* Scratch data used to evaluate each layer, reused every frame. */
+	FPaperZDAnimationPlaybackData LayerData;
+
 public:
 	//ctor
 	FPaperZDAnimNode_LayerAnimations();
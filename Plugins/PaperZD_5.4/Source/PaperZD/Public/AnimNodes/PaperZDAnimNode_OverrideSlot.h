@@ -25,6 +25,9 @@ struct PAPERZD_API FPaperZDAnimNode_OverrideSlot : public FPaperZDAnimNode_Base
 	FName GroupName;
 
 private:
+	/* Index of the slot on the AnimInstance override storage, resolved on initialization. */
+	int32 SlotIndex;
+
 	/* If there's an override currently playing for this slot. */
 	bool bOverride;
 
@@ -20,6 +20,10 @@ struct PAPERZD_API FPaperZDAnimNode_SetDirectionality : public FPaperZDAnimNode_
 	UPROPERTY(EditAnywhere, Category = "Input", meta = (AlwaysAsPin))
 	FVector2D Input;
 
+	/* If true, the direction resolved in batch by the AnimInstance is used instead of the input, with its sector stabilization. Requires the AnimInstance to resolve its direction in batch. */
+	UPROPERTY(EditAnywhere, Category = "Settings", meta = (NeverAsPin))
+	bool bUseResolvedDirection;
+
 	/* The directional angle, already cached. */
 	float CachedDirectionalAngle;
 
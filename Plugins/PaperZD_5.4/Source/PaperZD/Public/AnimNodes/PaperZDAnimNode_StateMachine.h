@@ -21,7 +21,7 @@ struct PAPERZD_API FPaperZDAnimNode_StateMachine : public FPaperZDAnimNode_Base
 	struct FNodeEvaluationContext
 	{
 		UObject* AnimInstance;
-		TSet<int32> VisitedNodes;
+		TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<8>> VisitedNodes;
 
 		//ctor
 		FNodeEvaluationContext(UObject* InAnimInstance = nullptr)
@@ -34,7 +34,6 @@ struct PAPERZD_API FPaperZDAnimNode_StateMachine : public FPaperZDAnimNode_Base
 	{
 		FPaperZDAnimNode_StateMachine* StateMachine;
 		const FPaperZDAnimationUpdateContext UpdateContext;
-		FDelegateHandle SequenceCompleteHandle;
 
 	public:
 		//ctor
@@ -43,9 +42,6 @@ struct PAPERZD_API FPaperZDAnimNode_StateMachine : public FPaperZDAnimNode_Base
 
 		/* Updates the animation. */
 		void Update();
-		
-		/* Called when the transitional animation completes. */
-		void OnTransitionalAnimationComplete(const UPaperZDAnimSequence* AnimSequence);
 	};
 
 	/* Index of the baked state machine definition on the generated class. */
@@ -83,9 +79,15 @@ public:
 	/* Obtain the name of the state machine linked to this node. */
 	FName GetMachineName() const;
 
+	/* Obtain the index of the state the machine is currently on. */
+	int32 GetCurrentStateIndex() const { return CurrentStateIndex; }
+
 	/* Takes the given JumpLink and forcefully sets the new target state to the JumpNode's target. */
 	void JumpToNode(FName Name, const FPaperZDAnimationBaseContext& Context);
 
+	/* Forcefully sets the given state, used to take jump links that were already resolved to their target state. */
+	void JumpToState(int32 StateIndex, const FPaperZDAnimationBaseContext& Context);
+
 private:
 	/* Sets the given state, triggering any delegate and adding the state's AnimNode to the queue. */
 	void SetState(int32 NewState, const FPaperZDAnimationBaseContext& Context);
@@ -60,6 +60,87 @@ public:
 	 {}
   };
 
+/**
+ * A notify entry on the baked timeline, with its play range resolved.
+ */
+USTRUCT()
+struct FPaperZDAnimTimelineNotify
+{
+	GENERATED_BODY()
+
+	/* Time at which the notify starts. */
+	UPROPERTY()
+	float StartTime = 0.0f;
+
+	/* Time at which the notify ends, same as the start time for instant notifies. */
+	UPROPERTY()
+	float EndTime = 0.0f;
+
+	/* The notify itself. */
+	UPROPERTY()
+	TObjectPtr<UPaperZDAnimNotify_Base> Notify;
+};
+
+/**
+ * Immutable playback information of a sequence, baked when cooking so the runtime doesn't need to query the animation source for it.
+ * Editor builds bake it on load, but keep querying the live data as the sequence and its animation source can change at any time.
+ */
+USTRUCT()
+struct PAPERZD_API FPaperZDAnimSequenceTimeline
+{
+	GENERATED_BODY()
+
+	/* Total duration of the sequence. */
+	UPROPERTY()
+	float Duration = 0.0f;
+
+	/* Frames per second of the sequence. */
+	UPROPERTY()
+	float FramesPerSecond = 0.0f;
+
+	/* Number of frames of the sequence. */
+	UPROPERTY()
+	int32 NumFrames = 0;
+
+	/* Notifies sorted by start time. */
+	UPROPERTY()
+	TArray<FPaperZDAnimTimelineNotify> Notifies;
+
+	/* True once the timeline holds valid data. */
+	UPROPERTY()
+	bool bBaked = false;
+
+public:
+	/* Obtain the frame number, given the playback time. */
+	int32 GetFrameAtTime(float Time) const
+	{
+		const int32 Frame = NumFrames > 0 ? FMath::RoundToInt(Time * FramesPerSecond) : 0;
+		return FMath::Clamp(Frame, 0, NumFrames);
+	}
+
+	/* Calls the given function for every notify that overlaps the [From, To] window, bounds included. */
+	template<typename FunctionType>
+	void ForEachNotifyInRange(float From, float To, FunctionType&& Function) const
+	{
+		for (const FPaperZDAnimTimelineNotify& Entry : Notifies)
+		{
+			//Sorted by start, nothing after this point can overlap
+			if (Entry.StartTime > To)
+			{
+				break;
+			}
+
+			if (Entry.EndTime >= From)
+			{
+				Function(Entry.Notify);
+			}
+		}
+	}
+
+	/* Memory used by the timeline, including the struct itself. */
+	SIZE_T GetAllocatedSize() const { return sizeof(FPaperZDAnimSequenceTimeline) + Notifies.GetAllocatedSize(); }
+};
+
 /**
  * The AnimSequence is the class responsible of handling how a given Animation source plays on the registered RenderComponent and handling meta info like AnimNotifies. 
  */
@@ -101,9 +182,23 @@ private:
 	FOnNotifyChangeSignature OnNotifyChange;
 #endif
 
+	/* Playback information baked for the runtime, see FPaperZDAnimSequenceTimeline. */
+	UPROPERTY()
+	FPaperZDAnimSequenceTimeline Timeline;
+
 	/* Cached DataSource property for faster lookup. */
 	FArrayProperty* CachedAnimDataSourceProperty;
 
+	/**
+	 * Baked lookup data for the AnimDataSource, resolved on load so runtime sampling doesn't need to go through reflection.
+	 * The array pointer is stable for the lifetime of the sequence, the remaining values are refreshed whenever the data source changes.
+	 */
+	const FScriptArray* BakedDataSource;
+	int32 BakedElementSize;
+	int32 BakedNumDirections;
+	float BakedAngleBias;
+	float BakedInvAngleSeparation;
+
 public:
 	UPROPERTY()
 	FName DisplayName_DEPRECATED; //@Deprecated
@@ -140,6 +235,9 @@ public:
 	//Required for version support
 	virtual void PostLoad() override;
 	virtual void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
 
 	/* Called after initializing the properties, but before serialization. */
 	virtual void PostInitProperties() override;
@@ -176,6 +274,40 @@ public:
 	/* Obtain the playback time, given the frame number. */
 	float GetTimeAtFrame(const int32 Frame) const;
 
+	/* Obtain the baked playback information of this sequence. */
+	const FPaperZDAnimSequenceTimeline& GetTimeline() const { return Timeline; }
+
+	/* Rebuilds the baked timeline from the current animation source data and notifies. */
+	void BakeTimeline();
+
+	/**
+	 * Duration to use for playback. Cooked builds read it from the baked timeline, avoiding the virtual call into the animation source.
+	 * Editor builds always use the live value, as the underlying animation can be edited while playing.
+	 */
+	FORCEINLINE float GetPlaybackDuration() const
+	{
+#if WITH_EDITOR
+		return GetTotalDuration();
+#else
+		return Timeline.bBaked ? Timeline.Duration : GetTotalDuration();
+#endif
+	}
+
+#if WITH_EDITOR
+	/* True if the editor was asked to cull notifies through the baked table as cooked builds do, see the "PaperZD.ForceBakedNotifies" cvar. */
+	static bool IsBakedNotifyCullingForced();
+#endif
+
+	/* True if the baked notify table can be used for culling notifies outside of the played window. */
+	FORCEINLINE bool CanUseBakedNotifies() const
+	{
+#if WITH_EDITOR
+		return Timeline.bBaked && IsBakedNotifyCullingForced();
+#else
+		return Timeline.bBaked;
+#endif
+	}
+
 	/**
 	 * Returns true if the given data source entry is considered as "set".
 	 * Override this entry if the AnimSequence supports Directional AnimDataSources to help it understand when a value is not set.
@@ -215,6 +347,22 @@ public:
 			return GetAnimationDataByIndex<T>(DirectionalPreviewIndex);
 		}
 #endif	
+		//Fast path, uses the table baked on load
+		if (IsDirectionalDataBaked())
+		{
+			if (bDirectionalSequence)
+			{
+				//Angles are biased by half an area and a full revolution on bake, which keeps negative angles on a normalized range
+				const int32 Area = (DirectionalAngle + BakedAngleBias) * BakedInvAngleSeparation;
+				return GetBakedAnimationData<T>(Area % BakedNumDirections);
+			}
+			else
+			{
+				return GetBakedAnimationData<T>(0);
+			}
+		}
+
+		//Data source hasn't been baked or changed since the last bake, resolve through reflection
 		if (bDirectionalSequence)
 		{
 			//Obtain the directional preview index from the given angle
@@ -240,8 +388,12 @@ public:
 	/* Angle to offset the "Directional Sequence" */
 	FORCEINLINE float GetDirectionalAngleOffset() const { return DirectionalAngleOffset; }
 
+	/* Amount of directions the sequence can play, one for non-directional sequences. */
+	int32 GetNumDirections() const;
+
 #if WITH_EDITOR
 	void PostEditUndo() override;
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 
 	/* Initializes the AnimTracks, making sure that we have enough metadata for any AnimNotify that we have stored. */
 	void InitTracks();
@@ -295,7 +447,21 @@ protected:
 	/* Requests the name of the array property to be used as the "AnimDataSource". */
 	virtual FName GetDataSourcePropertyName() const;
 
+	/* Refreshes the baked directional table, should be called whenever the AnimDataSource or the angle offset get modified. */
+	void BakeDirectionalData();
+
 private:
+	/* True if the baked table can be used for sampling, the entry count is compared to catch any change done to the data source after the bake. */
+	FORCEINLINE bool IsDirectionalDataBaked() const { return BakedDataSource && BakedDataSource->Num() == BakedNumDirections; }
+
+	/* Reads the given entry directly from the baked data source, index should be in range. */
+	template<typename T>
+	FORCEINLINE T GetBakedAnimationData(int32 Index) const
+	{
+		const uint8* Data = static_cast<const uint8*>(BakedDataSource->GetData());
+		return *reinterpret_cast<const T*>(Data + Index * BakedElementSize);
+	}
+
 	/* Initializes the Animation Data Source and makes sure its correctly configured for later use. */
 	void InitDataSource();
 };
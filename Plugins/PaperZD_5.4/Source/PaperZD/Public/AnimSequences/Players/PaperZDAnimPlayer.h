@@ -63,13 +63,17 @@ class PAPERZD_API UPaperZDAnimPlayer : public UObject
 		float CurrentTime;
 		float PreviousTime;
 		UPaperZDAnimInstance* OwningInstance;
+		int32 SubstepIndex;
+		float SubstepTime;
 
-		FAnimNotifyUpdateHandle(UPaperZDAnimNotify_Base* InAnimNotify, float InDeltaTime, float InCurrentTime, float InPreviousTime, UPaperZDAnimInstance* InOwningInstance)
+		FAnimNotifyUpdateHandle(UPaperZDAnimNotify_Base* InAnimNotify, float InDeltaTime, float InCurrentTime, float InPreviousTime, UPaperZDAnimInstance* InOwningInstance, int32 InSubstepIndex = 0, float InSubstepTime = 0.0f)
 			: AnimNotifyPtr(InAnimNotify)
 			, DeltaTime(InDeltaTime)
 			, CurrentTime(InCurrentTime)
 			, PreviousTime(InPreviousTime)
 			, OwningInstance(InOwningInstance)
+			, SubstepIndex(InSubstepIndex)
+			, SubstepTime(InSubstepTime)
 		{}
 
 		/* Type hash for set. */
@@ -89,6 +93,30 @@ class PAPERZD_API UPaperZDAnimPlayer : public UObject
 	/* Notifies that are considered 'active' for next update. */
 	TSet<FAnimNotifyUpdateHandle> ActiveNotifies;
 
+	/* Notifies that were active on the previous update, kept as a member so its storage is reused every frame. */
+	TSet<FAnimNotifyUpdateHandle> PreviousActiveNotifies;
+
+	/* Flags raised whenever a sequence completes its playback, pushed by the nodes that need to know about it while they update. */
+	TArray<bool*, TInlineAllocator<4>> SequenceCompleteFlags;
+
+	/* Simulation time that hasn't been consumed by a fixed substep yet. */
+	float FixedTimestepAccumulator;
+
+	/* Index of the fixed substep currently being simulated, zero when not using fixed timesteps. */
+	int32 CurrentSubstepIndex;
+
+	/* Time since the start of this frame's simulation at the end of the current substep. */
+	float CurrentSubstepTime;
+
+	/* Time since the start of this frame's simulation at which the notifies currently being processed were triggered. */
+	float CurrentNotifyTime;
+
+	/* Notifies processed on the last update, only kept while recording so a shared animation can replay them on other players. */
+	TArray<FAnimNotifyUpdateHandle> LastProcessedNotifyHandles;
+
+	/* If true, every processed notify gets copied into LastProcessedNotifyHandles. */
+	bool bRecordProcessedNotifies;
+
 	//State variables
 	bool bPlaying;
 	bool bPreviewPlayer;
@@ -126,6 +154,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Playback")
 	bool bFireSequenceChangedEvents;
 
+	/**
+	 * If true, the owning AnimInstance advances playback in fixed substeps of "FixedTimestep" seconds, independently of the frame rate.
+	 * Every substep triggers its own notifies, so notify windows and loops are processed the same way at any frame rate.
+	 * Time that doesn't fill a whole substep is carried over to the next frame.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Playback|Fixed Timestep")
+	bool bUseFixedTimestep;
+
+	/* Duration of each substep when using fixed timesteps, in seconds. Should be shorter than the shortest looping sequence for every loop to be detected. */
+	UPROPERTY(BlueprintReadWrite, Category = "Playback|Fixed Timestep", meta = (ClampMin = "0.001"))
+	float FixedTimestep;
+
+	/* Maximum number of substeps simulated on a single frame, any time beyond that is dropped to avoid spiraling on long hitches. */
+	UPROPERTY(BlueprintReadWrite, Category = "Playback|Fixed Timestep", meta = (ClampMin = "1"))
+	int32 MaxSubstepsPerFrame;
+
 public:
 	//ctor
 	UPaperZDAnimPlayer();
@@ -157,6 +201,43 @@ public:
 	 UFUNCTION(BlueprintPure, Category = "Playback")
 	 const UPaperZDAnimSequence* GetCurrentAnimSequence() const;
 
+	/**
+	 * Registers a flag that will be raised if any sequence completes its playback, until it's popped.
+	 * Cheaper alternative to binding the native completion delegate for nodes that need to listen only while they update.
+	 */
+	void PushSequenceCompleteFlag(bool* pFlag) { SequenceCompleteFlags.Push(pFlag); }
+
+	/* Removes the last registered sequence complete flag. */
+	void PopSequenceCompleteFlag() { SequenceCompleteFlags.Pop(); }
+
+	/**
+	 * Obtain the time, relative to the start of the frame's simulation, at which the notifies currently being triggered happened.
+	 * When using fixed timesteps this is the end of the substep that crossed the notify, otherwise always zero.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Playback|Fixed Timestep")
+	float GetCurrentNotifyTime() const { return CurrentNotifyTime; }
+
+	/**
+	 * Adds the given time to the fixed timestep accumulator and returns the number of substeps that should be simulated this frame.
+	 * Each substep should be surrounded by a "BeginSubstep" call, so the notifies it triggers are processed in order.
+	 */
+	int32 ConsumeFixedTimesteps(float DeltaTime);
+
+	/* Marks the start of the given substep, notifies triggered until the next call will be processed as part of it. */
+	void BeginSubstep(int32 SubstepIndex);
+
+	/* Marks the end of the substep simulation for this frame. */
+	void EndSubsteps();
+
+	/* Keeps a copy of the notifies processed on every update, so they can be replayed on other players with QueueNotifiesFrom. */
+	void SetRecordProcessedNotifies(bool bRecord);
+
+	/* Queues the notifies the source player processed on its last update, they will trigger for the given instance on this player's next playback. */
+	void QueueNotifiesFrom(const UPaperZDAnimPlayer* Source, UPaperZDAnimInstance* Instance);
+
+	/* Obtain the playback data that was rendered last. */
+	const FPaperZDAnimationPlaybackData& GetLastPlaybackData() const { return LastPlaybackData; }
+
 	/* Resets the cached current animation to none. */
 	void ClearCachedAnimationData();
 
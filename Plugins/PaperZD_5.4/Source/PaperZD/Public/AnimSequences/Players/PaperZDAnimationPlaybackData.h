@@ -43,13 +43,19 @@ public:
 	{}
 };
 
+/* Number of weighted animations that the playback data can hold without allocating, covers blends and layers on regular graphs. */
+#define ZD_INLINE_WEIGHTED_ANIMATIONS 4
+
+/* List of weighted animations, stored inline so building and copying the playback data doesn't touch the heap. */
+typedef TArray<FPaperZDWeightedAnimation, TInlineAllocator<ZD_INLINE_WEIGHTED_ANIMATIONS>> FPaperZDWeightedAnimationArray;
+
 /**
  * Structure used to pass animation playback data from the nodes onto the final render block
  */
 struct FPaperZDAnimationPlaybackData
 {
 	/* The list of weighted animations to apply. */
-	TArray<FPaperZDWeightedAnimation> WeightedAnimations;
+	FPaperZDWeightedAnimationArray WeightedAnimations;
 
 	/* The directional angle to use with multi-directional sequences. */
 	float DirectionalAngle;
@@ -68,4 +74,11 @@ public:
 	
 	/* Adds an animation with the given weight at the end of the stack. */
 	void AddAnimation(const UPaperZDAnimSequence* Sequence, float PlaybackTime, float Weight = 1.0f);
+
+	/* Clears the data so it can be reused for another evaluation, keeping any allocated storage. */
+	void Reset()
+	{
+		WeightedAnimations.Reset();
+		DirectionalAngle = 0.0f;
+	}
 };
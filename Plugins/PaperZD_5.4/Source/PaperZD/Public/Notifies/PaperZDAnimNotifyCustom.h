@@ -11,6 +11,9 @@ UCLASS()
 class PAPERZD_API UPaperZDAnimNotifyCustom : public UPaperZDAnimNotify
 {
 	GENERATED_UCLASS_BODY()
+
+	/* Index of this notify on the last AnimBP class that fired it. */
+	mutable int32 CachedNotifyIndex;
 			
 public:
 	//Override the native notify implementation
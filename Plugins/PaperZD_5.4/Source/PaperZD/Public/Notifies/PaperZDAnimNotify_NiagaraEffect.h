@@ -45,6 +45,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AnimNotify")
 	FName SocketName;
 
+	// Whether the effect component should be taken from the world's component pool instead of being created every time. The pool size is configured on the Niagara system
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	bool bUseEffectPool;
+
 public:
 	//ctor
 	UPaperZDAnimNotify_NiagaraEffect();
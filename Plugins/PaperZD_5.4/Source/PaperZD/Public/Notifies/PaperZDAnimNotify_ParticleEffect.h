@@ -45,6 +45,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AnimNotify")
 	FName SocketName;
 
+	// Whether the effect component should be taken from the world's component pool instead of being created every time
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	bool bUseEffectPool;
 
 public:
 	UPaperZDAnimNotify_ParticleEffect();
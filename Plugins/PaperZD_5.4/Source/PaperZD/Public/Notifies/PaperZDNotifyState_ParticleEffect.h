@@ -8,6 +8,7 @@
 #include "PaperZDNotifyState_ParticleEffect.generated.h"
 
 class UParticleSystem;
+class UParticleSystemComponent;
 
 /**
  * Spawns a one shot particle effect on a given location around the RenderComponent.
@@ -60,6 +61,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "AnimNotify", meta = (DisplayName = "Destroy Immediately", ToolTip = "Whether the particle system should be immediately destroyed at the end of the notify state or be allowed to finish"))
 	bool bDestroyAtEnd;
 
+	// Whether the effect component should be taken from the world's component pool instead of being created every time
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	bool bUseEffectPool;
+
 public:
 	//ctor
 	UPaperZDNotifyState_ParticleEffect();
@@ -79,4 +84,8 @@ public:
 private:
 	/* Tag to use to recognize the effects that get spawned by this notify state. */
 	FORCEINLINE FName GetSpawnedComponentTag()const { return GetFName(); }
+
+	/* Untags a pooled component once its system finishes, so the pool can hand it to another owner without this notify claiming it. */
+	UFUNCTION()
+	void OnSpawnedSystemFinished(UParticleSystemComponent* Component);
 };
@@ -20,6 +20,16 @@ struct PAPERZD_API FPaperZDAnimBPDebugData
 	GENERATED_BODY()
 };
 
+/* Target of a jump link, cached by name on the generated class. */
+struct FPaperZDJumpLinkTarget
+{
+	/* Index of the state machine node (in declaration order) that owns the link. */
+	int32 StateMachineNodeIndex;
+
+	/* State that the link jumps to. */
+	int32 TargetStateIndex;
+};
+
 /* Holds the descriptor for a slot override that has been registered to the class. */
 USTRUCT()
 struct FPaperZDOverrideSlotDescriptor
@@ -33,6 +43,14 @@ struct FPaperZDOverrideSlotDescriptor
 	/* Name of the group that the slot belongs to. */
 	UPROPERTY()
 	FName GroupName;
+
+	/* Index of the slot, assigned when compiling the AnimBP. Used by the instances to address their per-slot storage. */
+	UPROPERTY()
+	int32 SlotIndex = INDEX_NONE;
+
+	/* Index of the group, assigned when compiling the AnimBP. Slots that share a group share the same index. */
+	UPROPERTY()
+	int32 GroupIndex = INDEX_NONE;
 };
 
 /**
@@ -63,6 +81,10 @@ class PAPERZD_API UPaperZDAnimBPGeneratedClass : public UBlueprintGeneratedClass
 	UPROPERTY()
 	TMap<FName, FName> AnimNotifyFunctionMapping;
 
+	/* Custom AnimNotify names registered on the animation source at compile time, the source only keeps them as editor data. */
+	UPROPERTY()
+	TArray<FName> RegisteredNotifyNames;
+
 	/* List of registered override animation slots for this class, keyed by the slot name */
 	UPROPERTY()
 	TMap<FName, FPaperZDOverrideSlotDescriptor> RegisteredOverrideSlots;
@@ -71,9 +93,34 @@ class PAPERZD_API UPaperZDAnimBPGeneratedClass : public UBlueprintGeneratedClass
 	TArray<FStructProperty*> AnimNodeProperties;
 	TArray<FStructProperty*> StateMachineNodeProperties;
 
+	/* Byte offsets of the node properties inside the AnimInstance, so nodes can be resolved without going through the property. */
+	TArray<int32> AnimNodeOffsets;
+	TArray<int32> StateMachineNodeOffsets;
+
+	/* Jump link targets keyed by the jump name, a name can be used on more than one state machine. */
+	TMap<FName, TArray<FPaperZDJumpLinkTarget, TInlineAllocator<1>>> JumpLinkTargets;
+
 	/* Pointer to the root node property. */
 	FStructProperty* RootNodeProperty;
 
+	/* Number of distinct override groups, cached after load/compile. */
+	int32 NumOverrideGroups;
+
+	/* Group index of each override slot, indexed by slot index. */
+	TArray<int32> OverrideSlotGroupIndices;
+
+	/* Custom AnimNotify names, the position of each name is the index used to address the notify at runtime. Built on first use. */
+	mutable TArray<FName> AnimNotifyNames;
+
+	/* Lookup from the custom AnimNotify name to its index. */
+	mutable TMap<FName, int32> AnimNotifyIndices;
+
+	/* Function implementing each custom AnimNotify on this class, indexed by notify index. Null for notifies without an implementation. */
+	mutable TArray<UFunction*> AnimNotifyFunctions;
+
+	/* True once the AnimNotify index table has been built. */
+	mutable bool bAnimNotifyTableBuilt;
+
 public:
 	//ctor
 	UPaperZDAnimBPGeneratedClass();
@@ -90,15 +137,51 @@ public:
 	/* Called after a link, to cache the nodes that require special treatment. */
 	void CacheRequiredNodes(UObject* DefaultObject);
 
+private:
+	/* Makes sure every override slot has valid indices (assets compiled before indices existed get them assigned here) and caches the group count. */
+	void CacheOverrideSlotIndices();
+
+	/* Builds the jump link lookup, which requires the state machine nodes of the default object to be initialized. */
+	void CacheJumpLinkTargets(UObject* DefaultObject);
+
+	/**
+	 * Builds the custom AnimNotify index table, if it wasn't built yet.
+	 * Names registered on the animation source come first, so AnimBPs sharing a source use the same index for the same notify.
+	 */
+	void ConditionalBuildAnimNotifyTable() const;
+
+public:
+
 	/* Obtain the root node from an AnimInstance object. */
 	FPaperZDAnimNode_Sink* GetRootNode(UObject* AnimInstanceObject) const;
 
 	/* Obtain a list of the StateMachine nodes that live on the AnimInstance. */
 	TArray<FPaperZDAnimNode_StateMachine*> GetStateMachineNodes(UObject* AnimInstanceObject) const;
 
+	/* Number of StateMachine nodes that live on the AnimInstance. */
+	int32 GetNumStateMachineNodes() const { return StateMachineNodeOffsets.Num(); }
+
+	/* Obtain the StateMachine node with the given index (in declaration order) without allocating. */
+	FPaperZDAnimNode_StateMachine* GetStateMachineNode(UObject* AnimInstanceObject, int32 Index) const;
+
+	/* Obtain the targets of every jump link with the given name, null if no state machine has such link. */
+	const TArray<FPaperZDJumpLinkTarget, TInlineAllocator<1>>* FindJumpLinkTargets(FName JumpName) const { return JumpLinkTargets.Find(JumpName); }
+
 	/* Finds the function implementation for the AnimNotify with the given name. */
 	UFunction* FindAnimNotifyFunction(FName AnimNotifyName) const;
 
+	/* Obtain the index of the custom AnimNotify with the given name, INDEX_NONE if the notify isn't known to this class. */
+	int32 GetAnimNotifyIndex(FName AnimNotifyName) const;
+
+	/* Obtain the name of the custom AnimNotify with the given index, NAME_None if the index is invalid. */
+	FName GetAnimNotifyName(int32 AnimNotifyIndex) const;
+
+	/* Obtain the function implementing the custom AnimNotify with the given index, can be null. */
+	UFunction* GetAnimNotifyFunction(int32 AnimNotifyIndex) const;
+
+	/* Number of custom AnimNotifies addressable on this class. */
+	int32 GetNumAnimNotifies() const;
+
 	/* Obtain the AnimNode that is linked by the given LinkID. */
 	FPaperZDAnimNode_Base* GetAnimNodeByLinkID(UObject* AnimInstanceObject, int32 LinkID) const;
 
@@ -120,6 +203,24 @@ public:
 
 	/* Check if the given slot has been registered. */
 	bool GetOverrideSlotDescriptor(FName SlotName, FPaperZDOverrideSlotDescriptor& SlotDescriptor) const;
+
+	/* Obtain the index of the given override slot, INDEX_NONE if the slot hasn't been registered. */
+	int32 GetOverrideSlotIndex(FName SlotName) const;
+
+	/* Obtain the index of the given override group, INDEX_NONE if no slot belongs to the group. */
+	int32 GetOverrideGroupIndex(FName GroupName) const;
+
+	/* Obtain the group index of the override slot with the given index, INDEX_NONE if the slot index is invalid. */
+	int32 GetOverrideSlotGroupIndex(int32 SlotIndex) const { return OverrideSlotGroupIndices.IsValidIndex(SlotIndex) ? OverrideSlotGroupIndices[SlotIndex] : INDEX_NONE; }
+
+	/* Number of override slots registered to this class. */
+	int32 GetNumOverrideSlots() const { return RegisteredOverrideSlots.Num(); }
+
+	/* Number of distinct override groups registered to this class. */
+	int32 GetNumOverrideGroups() const { return NumOverrideGroups; }
+
+	/* Get every override slot registered to this class, keyed by the slot name. */
+	const TMap<FName, FPaperZDOverrideSlotDescriptor>& GetOverrideSlotDescriptors() const { return RegisteredOverrideSlots; }
 };
 
 /* Helper function to quickly obtain the ZD AnimGeneratedClass from the given object. */
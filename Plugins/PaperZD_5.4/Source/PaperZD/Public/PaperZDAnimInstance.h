@@ -13,10 +13,57 @@ class UPaperZDAnimPlayer;
 class UWorld;
 class UFunction;
 class APaperZDCharacter;
+class UPaperZDAnimSharingSubsystem;
+class UPaperZDDirectionalitySubsystem;
 struct FPaperZDAnimNode_Sink;
+struct FPaperZDAnimNode_StateMachine;
+struct FPaperZDAnimSharingKey;
 
 //Delegate declarations
 DECLARE_DELEGATE_OneParam(FZDOnAnimationOverrideEndSignature, bool /* bCompleted */);
+DECLARE_DELEGATE(FZDOnAnimNotifyNativeSignature);
+DECLARE_DYNAMIC_DELEGATE(FZDOnAnimNotifySignature);
+
+/**
+ * Plane in which the owning actor moves, used to resolve its direction for multi-directional sequences.
+ */
+UENUM(BlueprintType)
+enum class EPaperZDDirectionPlane : uint8
+{
+	/* Side view, X points right and Z points to the top of the screen. */
+	SideView UMETA(DisplayName = "Side View (XZ)"),
+
+	/* Top-down view, Y points right and X points to the top of the screen. */
+	TopDown UMETA(DisplayName = "Top Down (XY)")
+};
+
+/**
+ * Identifies an animation override played on an AnimInstance.
+ * Handles become invalid once the override ends, or when another override is played on the same group.
+ */
+USTRUCT(BlueprintType)
+struct PAPERZD_API FPaperZDAnimationOverrideHandle
+{
+	GENERATED_BODY()
+
+	/* Group the override is being played on. */
+	UPROPERTY(Transient)
+	int32 GroupIndex;
+
+	/* Unique number of the override, zero for invalid handles. */
+	UPROPERTY(Transient)
+	uint32 SerialNumber;
+
+public:
+	//ctor
+	FPaperZDAnimationOverrideHandle()
+		: GroupIndex(INDEX_NONE)
+		, SerialNumber(0)
+	{}
+
+	/* True if the handle was obtained from a successful play call, doesn't mean the override is still playing. */
+	bool IsValid() const { return SerialNumber != 0; }
+};
 
 /**
  * Runtime class that the AnimBP gets compiled into.
@@ -26,6 +73,12 @@ class PAPERZD_API UPaperZDAnimInstance : public UObject
 {
 	GENERATED_BODY()
 
+	/* The sharing subsystem manages our bucket membership directly. */
+	friend class UPaperZDAnimSharingSubsystem;
+
+	/* The directionality subsystem writes the resolved direction directly. */
+	friend class UPaperZDDirectionalitySubsystem;
+
 	/* Pointer to the Animation Player that is responsible of the playback of the sequences. */
 	UPROPERTY(Transient)
 	TObjectPtr<UPaperZDAnimPlayer> AnimPlayer;
@@ -33,6 +86,12 @@ class PAPERZD_API UPaperZDAnimInstance : public UObject
 	/* The main sink node that collects the final animation data. */
 	FPaperZDAnimNode_Sink* RootNode;
 
+	/* Direct pointers to the state machine nodes of this instance, in declaration order. Cached on init. */
+	TArray<FPaperZDAnimNode_StateMachine*, TInlineAllocator<2>> StateMachineNodes;
+
+	/* Scratch playback data the graph gets evaluated into, reset and reused every frame. */
+	FPaperZDAnimationPlaybackData EvaluationData;
+
 	/* Manager for this AnimInstance, which we query for context information. */
 	TScriptInterface<IPaperZDAnimInstanceManager> Manager;
 	
@@ -54,33 +113,99 @@ class PAPERZD_API UPaperZDAnimInstance : public UObject
 		/* AnimSequence to play, null if not playing. */
 		TWeakObjectPtr<const UPaperZDAnimSequence> AnimSequencePtr;
 
-		/* Name of the overridden slot. */
-		FName SlotName;
-
-		/* Group of the overridden slot. */
-		FName GroupName;
+		/* Index of the overridden slot. */
+		int32 SlotIndex = INDEX_NONE;
 
 		/* Current playback time. */
 		float PlaybackTime = 0.0f;
 
 		/* Play rate to use. */
-		float PlayRate;
+		float PlayRate = 1.0f;
+
+		/* Unique number of the override being played, zero when the group is idle. */
+		uint32 SerialNumber = 0;
 
 		/* Callback function. */
 		FZDOnAnimationOverrideEndSignature OnOverrideEnd;
+
+	public:
+		bool IsActive() const { return SerialNumber != 0; }
 	};
+
+	/* Running overrides, indexed by override group as only one override can be played per group. Sized on init, so it never reallocates while ticking. */
 	TArray<FAnimationOverrideHandle> AnimationOverrideHandles;
 
+	/* Serial number given to the last animation override played. */
+	uint32 LastOverrideSerialNumber;
+
 	/* The override data already processed for 'slots' to use. */
 	struct FProcessedAnimationOverrideData
 	{
-		/* Name of the overridden slot. */
-		FName SlotName;
+		/* If the slot has data to consume on this update. */
+		bool bValid = false;
 
 		/* The playback data for the slot to consume. */
 		FPaperZDAnimationPlaybackData PlaybackData;
 	};
+
+	/* Processed override data, indexed by override slot. Sized on init and reused every frame. */
 	TArray<FProcessedAnimationOverrideData> ProcessedOverrideData;
+
+	/* Callbacks bound to a custom AnimNotify. */
+	struct FAnimNotifyHandler
+	{
+		/* Native callback, called directly without going through reflection. */
+		FZDOnAnimNotifyNativeSignature NativeDelegate;
+
+		/* Callback bound from blueprint or script. */
+		FZDOnAnimNotifySignature ScriptDelegate;
+	};
+
+	/* Custom AnimNotify callbacks, indexed by the notify index of our class. Sized on init. */
+	TArray<FAnimNotifyHandler> AnimNotifyHandlers;
+
+	/* Membership of this instance on the animation sharing subsystem. */
+	struct FAnimationSharingState
+	{
+		/* Index of the bucket we belong to, INDEX_NONE if we're running our own graph without sharing it. */
+		int32 BucketIndex = INDEX_NONE;
+
+		/* Subsystem owning our bucket, kept so we can leave it even once our world can't be reached anymore. */
+		TWeakObjectPtr<UPaperZDAnimSharingSubsystem> Subsystem;
+
+		/* If true, the leader of our bucket evaluates the animations for us. */
+		bool bFollower = false;
+
+		/* If true, gameplay requested unique animation behavior and we shouldn't join any bucket. */
+		bool bSuspended = false;
+
+		/* Time skipped while following, consumed by a notify-free catch-up update once we run our own graph again (the leader's notifies were replayed on us meanwhile). */
+		float PendingDeltaTime = 0.0f;
+
+		/* Time since we last ran our own graph. */
+		float TimeSinceResync = 0.0f;
+	};
+	FAnimationSharingState SharingState;
+
+	/* Direction resolved for this instance by the directionality subsystem. */
+	struct FDirectionalityState
+	{
+		/* Subsystem resolving our direction, kept so we can leave the batch once our world is gone. */
+		TWeakObjectPtr<UPaperZDDirectionalitySubsystem> Subsystem;
+
+		/* Index of our entry on the subsystem, INDEX_NONE if we aren't being resolved. */
+		int32 EntryIndex = INDEX_NONE;
+
+		/* Sector we're currently facing, INDEX_NONE until the first resolve. */
+		int32 Sector = INDEX_NONE;
+
+		/* Amount of sectors the current sector was resolved with. */
+		int32 NumSectors = 0;
+
+		/* Angle at the center of the current sector, in degrees against the top of the animation. */
+		float Angle = 0.0f;
+	};
+	FDirectionalityState DirectionalityState;
 	
 public:
 	/* If this AnimBP should globally ignore time dilation. */
@@ -96,6 +221,47 @@ private:
 	UPROPERTY(EditAnywhere, Category = "PaperZD")
 	bool bAllowTransitionalStates;
 
+	/**
+	 * If true, instances of this AnimBP that are playing the same state and frame get grouped and only one of them runs the animation graph, sharing the result with the rest.
+	 * Useful for crowds of identical characters. Instances leave the group whenever they need unique behavior (overrides, jumps or an explicit suspension).
+	 * Notifies the leader triggers are replayed on every follower, so notify events and native notify handlers still fire on each instance.
+	 * Sequence complete events and state machine transitions of a follower only run on its own evaluations, once every resync interval.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Animation Sharing")
+	bool bEnableAnimationSharing;
+
+	/* Playback time granularity used to decide if two instances are on the same frame, in seconds. */
+	UPROPERTY(EditAnywhere, Category = "Animation Sharing", meta = (EditCondition = "bEnableAnimationSharing", UIMin = "0.01", ClampMin = "0.01"))
+	float AnimationSharingTimeStep;
+
+	/* Time after which a follower runs its own graph again, to pick up any state change driven by its own variables. */
+	UPROPERTY(EditAnywhere, Category = "Animation Sharing", meta = (EditCondition = "bEnableAnimationSharing", UIMin = "0.0", ClampMin = "0.0"))
+	float AnimationSharingResyncInterval;
+
+	/**
+	 * If true, the direction of the owning actor is resolved into a sector on a batch with every other instance of the world, once per frame after movement (TG_PostPhysics).
+	 * Instances ticking before that use the direction resolved on the previous frame, tick the animation component on TG_PostUpdateWork to read the one of the current frame.
+	 * Use the "Use Resolved Direction" option on the SetDirectionality node (or GetResolvedDirectionalAngle) to drive multi-directional sequences with it.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Directionality")
+	bool bResolveDirectionInBatch;
+
+	/* Plane the owning actor moves on. */
+	UPROPERTY(EditAnywhere, Category = "Directionality", meta = (EditCondition = "bResolveDirectionInBatch"))
+	EPaperZDDirectionPlane DirectionalPlane;
+
+	/* Amount of directions to resolve while the sequence being played isn't multi-directional, otherwise the directions of the sequence are used. */
+	UPROPERTY(EditAnywhere, Category = "Directionality", meta = (EditCondition = "bResolveDirectionInBatch", UIMin = "1", ClampMin = "1", UIMax = "32"))
+	int32 DirectionalSectors;
+
+	/* Degrees the direction has to go past a sector boundary before switching sectors, avoids flickering when moving along a boundary. */
+	UPROPERTY(EditAnywhere, Category = "Directionality", meta = (EditCondition = "bResolveDirectionInBatch", UIMin = "0.0", ClampMin = "0.0", UIMax = "45.0"))
+	float DirectionalHysteresis;
+
+	/* Speed under which the actor is considered idle and its facing is used instead of its velocity. */
+	UPROPERTY(EditAnywhere, Category = "Directionality", meta = (EditCondition = "bResolveDirectionInBatch", UIMin = "0.0", ClampMin = "0.0"))
+	float DirectionalMinSpeed;
+
 public:
 	//ctor
 	UPaperZDAnimInstance();
@@ -103,6 +269,10 @@ public:
 	/* We obtain the world from the character defined. */
 	virtual class UWorld* GetWorld() const override;
 
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
 	/* Tick every frame. */
 	virtual void Tick(float DeltaTime);
 
@@ -112,6 +282,30 @@ public:
 	/* Tries to find the UFunction that implements the notify with the given name. */
 	UFunction* FindAnimNotifyFunction(FName AnimNotifyName) const;
 
+	/* Obtain the index of the custom AnimNotify with the given name, INDEX_NONE if our AnimBP doesn't know about it. */
+	int32 GetAnimNotifyIndex(FName AnimNotifyName) const;
+
+	/**
+	 * Binds a native callback to the custom AnimNotify with the given name, replacing any native callback previously bound to it.
+	 * The callback runs directly when the notify fires, before the AnimBP implementation of the notify (if any).
+	 * @return	True if the notify is known to our AnimBP and the callback was bound.
+	 */
+	bool BindAnimNotify(FName AnimNotifyName, FZDOnAnimNotifyNativeSignature Delegate);
+
+	/* Binds a callback from blueprint or script to the custom AnimNotify with the given name. */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD|Notifies", meta = (DisplayName = "Bind Anim Notify"))
+	bool K2_BindAnimNotify(FName AnimNotifyName, FZDOnAnimNotifySignature Delegate);
+
+	/* Removes every callback bound to the custom AnimNotify with the given name. */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD|Notifies")
+	void UnbindAnimNotify(FName AnimNotifyName);
+
+	/**
+	 * Fires the custom AnimNotify with the given index, calling the bound callbacks and the AnimBP implementation.
+	 * @return	True if anything handled the notify.
+	 */
+	bool TriggerAnimNotify(int32 AnimNotifyIndex);
+
 	/**
 	 * Called every tick, after all the animations have been processed.
 	 */
@@ -178,10 +372,36 @@ public:
 	/* Play the given animation through the override slot. Returns whether the animation has correctly been queued. */
 	bool PlayAnimationOverride(const UPaperZDAnimSequence* AnimSequence, FName SlotName = "DefaultSlot", float PlayRate = 1.0f, float StartingPosition = 0.0f, FZDOnAnimationOverrideEndSignature OnOverrideEnd = FZDOnAnimationOverrideEndSignature());
 
+	/* Play the given animation through the override slot. Returns a handle that can be used to query or stop the override, invalid if the animation couldn't be played. */
+	FPaperZDAnimationOverrideHandle PlayAnimationOverrideWithHandle(const UPaperZDAnimSequence* AnimSequence, FName SlotName = "DefaultSlot", float PlayRate = 1.0f, float StartingPosition = 0.0f, FZDOnAnimationOverrideEndSignature OnOverrideEnd = FZDOnAnimationOverrideEndSignature());
+
+	/* Play the given animation through the override slot with the given index (see GetOverrideSlotIndex), avoiding any name lookup. */
+	FPaperZDAnimationOverrideHandle PlayAnimationOverrideBySlotIndex(const UPaperZDAnimSequence* AnimSequence, int32 SlotIndex, float PlayRate = 1.0f, float StartingPosition = 0.0f, FZDOnAnimationOverrideEndSignature OnOverrideEnd = FZDOnAnimationOverrideEndSignature());
+
 	/* Play the given animation through the override slot. Returns the animation length if successful. */
 	UFUNCTION(BlueprintCallable, Category= "Playback", meta = (DisplayName = "Play Animation Override"))
 	void K2_PlayAnimationOverride(const UPaperZDAnimSequence* AnimSequence, float& AnimationLength, FName SlotName = "DefaultSlot", float PlayRate = 1.0f, float StartingPosition = 0.0f);
 
+	/* Play the given animation through the override slot. Returns a handle that can be used to query or stop the override. */
+	UFUNCTION(BlueprintCallable, Category = "Playback", meta = (DisplayName = "Play Animation Override With Handle"))
+	FPaperZDAnimationOverrideHandle K2_PlayAnimationOverrideWithHandle(const UPaperZDAnimSequence* AnimSequence, FName SlotName = "DefaultSlot", float PlayRate = 1.0f, float StartingPosition = 0.0f);
+
+	/* Obtain the index of the given override slot, which can be cached to play overrides without name lookups. INDEX_NONE if the slot doesn't exist. */
+	UFUNCTION(BlueprintPure, Category = "Playback")
+	int32 GetOverrideSlotIndex(FName SlotName) const;
+
+	/* Stops the animation override referenced by the handle, if it's still playing. */
+	UFUNCTION(BlueprintCallable, Category = "Playback")
+	void StopAnimationOverride(const FPaperZDAnimationOverrideHandle& Handle);
+
+	/* True if the animation override referenced by the handle is still playing. */
+	UFUNCTION(BlueprintPure, Category = "Playback")
+	bool IsAnimationOverridePlaying(const FPaperZDAnimationOverrideHandle& Handle) const;
+
+	/* Obtain the current playback time of the animation override referenced by the handle, zero if it isn't playing anymore. */
+	UFUNCTION(BlueprintPure, Category = "Playback")
+	float GetAnimationOverridePlaybackTime(const FPaperZDAnimationOverrideHandle& Handle) const;
+
 	/* Stops the animation override with the given group name. */
 	UFUNCTION(BlueprintCallable, Category = "Playback")
 	void StopAnimationOverrideByGroup(FName GroupToStop = "DefaultGroup");
@@ -190,12 +410,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Playback")
 	void StopAllAnimationOverrides();
 
+	/**
+	 * Suspends or resumes animation sharing for this instance. While suspended the instance always runs its own animation graph.
+	 * Use it whenever the actor needs unique animation behavior, like reacting to a hit.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Animation Sharing")
+	void SetAnimationSharingSuspended(bool bSuspended);
+
+	/* True if another instance is currently evaluating the animations for this one. */
+	UFUNCTION(BlueprintPure, Category = "Animation Sharing")
+	bool IsFollowingSharedAnimation() const { return SharingState.bFollower; }
+
+	/* Obtain the angle of the last direction resolved, snapped to the center of its sector. Only updated when resolving the direction in batch. */
+	UFUNCTION(BlueprintPure, Category = "Directionality")
+	float GetResolvedDirectionalAngle() const { return DirectionalityState.Angle; }
+
+	/* Obtain the sector of the last direction resolved, INDEX_NONE if no direction has been resolved yet. */
+	UFUNCTION(BlueprintPure, Category = "Directionality")
+	int32 GetResolvedDirectionalSector() const { return DirectionalityState.Sector; }
+
+	/* True if the direction of this instance is being resolved by the directionality subsystem. */
+	bool IsResolvingDirectionInBatch() const { return DirectionalityState.EntryIndex != INDEX_NONE; }
+
 	/* Get the playback information for the given slot. */
 	bool GetAnimationOverrideDataBySlot(FName SlotName, FPaperZDAnimationPlaybackData& OutPlaybackData) const;
 
 	/* Sets the animation override data on a specific slot. If 'overwrite' is set to true it will write on top of any existing override. */
 	void SetAnimationOverrideDataBySlot(FName SlotName, const FPaperZDAnimationPlaybackData& PlaybackData, bool bOverwriteExisting = false);
 
+	/* Get the playback information for the slot with the given index, null if the slot isn't being overridden. */
+	const FPaperZDAnimationPlaybackData* GetAnimationOverrideDataBySlotIndex(int32 SlotIndex) const;
+
+	/* Sets the animation override data on the slot with the given index. If 'overwrite' is set to true it will write on top of any existing override. */
+	void SetAnimationOverrideDataBySlotIndex(int32 SlotIndex, const FPaperZDAnimationPlaybackData& PlaybackData, bool bOverwriteExisting = false);
+
 	 /** Gets the length in seconds of the asset referenced in an asset player node */
 	UFUNCTION(BlueprintPure, Category="Asset Player", meta=(DisplayName="Length", BlueprintInternalUseOnly="true", AnimGetter="true"))
 	float GetInstanceAssetPlayerLength(int32 AssetPlayerIndex);
@@ -223,6 +471,36 @@ private:
 	/* Process the animation nodes. */
 	void ProcessAnimations(float DeltaTime);
 
+	/* Runs a single update pass over the overrides and the animation graph. */
+	void UpdateAnimGraph(float DeltaTime);
+
 	/* Update any animation override that is currently running. */
 	void UpdateAnimationOverrides(float DeltaTime);
+
+	/* Marks the processed override data as consumed, keeping the storage for the next update. */
+	void ClearProcessedOverrideData();
+
+	/* True if any animation override is currently running. */
+	bool HasActiveAnimationOverrides() const;
+
+	/* Updates the animation nodes without rendering nor triggering notifies, used to catch up on time skipped while following a shared animation. */
+	void CatchUpAnimations(float DeltaTime);
+
+	/* Obtain the sharing subsystem of our world, only if this instance opted into sharing. */
+	UPaperZDAnimSharingSubsystem* GetSharingSubsystem() const;
+
+	/* True if the current frame of this instance can be shared with others. */
+	bool CanShareAnimation() const;
+
+	/* Builds the key that identifies the frame we just rendered. */
+	FPaperZDAnimSharingKey BuildSharingKey() const;
+
+	/* Leaves the sharing bucket we're in, if any. */
+	void LeaveSharedAnimation();
+
+	/* Obtain the directionality subsystem of our world, only if this instance opted into batched directionality. */
+	UPaperZDDirectionalitySubsystem* GetDirectionalitySubsystem() const;
+
+	/* Obtain the handler slot for the given notify, making sure the table is big enough. Null if the notify is unknown. */
+	FAnimNotifyHandler* FindOrAddAnimNotifyHandler(FName AnimNotifyName);
 };
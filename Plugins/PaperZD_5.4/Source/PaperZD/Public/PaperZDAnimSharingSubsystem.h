@@ -0,0 +1,109 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AnimSequences/Players/PaperZDAnimationPlaybackData.h"
+#include "PaperZDAnimSharingSubsystem.generated.h"
+
+class UPaperZDAnimInstance;
+class UPaperZDAnimSequence;
+
+/**
+ * Identifies the animation frame an AnimInstance rendered, instances that produce the same key can share a single evaluation.
+ */
+struct FPaperZDAnimSharingKey
+{
+	/* The AnimBP class of the instance. */
+	const UClass* AnimClass;
+
+	/* Primary sequence that was rendered. */
+	const UPaperZDAnimSequence* AnimSequence;
+
+	/* Combined hash of the current state on every state machine of the instance. */
+	uint32 StateHash;
+
+	/* Playback time, quantized to the sharing time step. */
+	int32 QuantizedTime;
+
+	/* Directional angle, quantized to a sector. */
+	int32 QuantizedAngle;
+
+public:
+	//ctor
+	FPaperZDAnimSharingKey()
+		: AnimClass(nullptr)
+		, AnimSequence(nullptr)
+		, StateHash(0)
+		, QuantizedTime(0)
+		, QuantizedAngle(0)
+	{}
+
+	bool operator==(const FPaperZDAnimSharingKey& Other) const
+	{
+		return AnimClass == Other.AnimClass && AnimSequence == Other.AnimSequence && StateHash == Other.StateHash && QuantizedTime == Other.QuantizedTime && QuantizedAngle == Other.QuantizedAngle;
+	}
+
+	friend uint32 GetTypeHash(const FPaperZDAnimSharingKey& Key)
+	{
+		uint32 Hash = HashCombine(PointerHash(Key.AnimClass), PointerHash(Key.AnimSequence));
+		Hash = HashCombine(Hash, Key.StateHash);
+		Hash = HashCombine(Hash, GetTypeHash(Key.QuantizedTime));
+		return HashCombine(Hash, GetTypeHash(Key.QuantizedAngle));
+	}
+};
+
+/**
+ * Groups AnimInstances that opted into animation sharing and are rendering the same animation frame into buckets.
+ * Only the leader of each bucket runs its animation graph, the resulting playback data gets fanned out to the render components of every follower.
+ * This makes crowds using the same AnimBP scale with the number of distinct states being played, instead of the number of actors.
+ */
+UCLASS()
+class PAPERZD_API UPaperZDAnimSharingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/* A group of instances sharing the same evaluation. */
+	struct FSharingBucket
+	{
+		/* Instance that runs the animation graph for the whole bucket. */
+		TWeakObjectPtr<UPaperZDAnimInstance> Leader;
+
+		/* Instances that only receive the leader's playback data. */
+		TArray<TWeakObjectPtr<UPaperZDAnimInstance>> Followers;
+
+		/* Key that the leader produced on its last evaluation. */
+		FPaperZDAnimSharingKey Key;
+	};
+
+	/* Active buckets, indices are stable and stored on the member instances. */
+	TSparseArray<FSharingBucket> Buckets;
+
+	/* Lookup from the last key produced by a leader to its bucket. */
+	TMap<FPaperZDAnimSharingKey, int32> BucketsByKey;
+
+public:
+	//~ Begin USubsystem Interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/**
+	 * Called by an instance that just ran its own animation graph.
+	 * Leaders fan the playback data out to their followers, while instances without a bucket either join a bucket that matches the key or start a new one.
+	 */
+	void RegisterEvaluation(UPaperZDAnimInstance* Instance, const FPaperZDAnimSharingKey& Key, const FPaperZDAnimationPlaybackData& PlaybackData);
+
+	/* Removes the instance from its bucket, dissolving the bucket if the instance was leading it. */
+	void RemoveInstance(UPaperZDAnimInstance* Instance);
+
+	/* Number of buckets currently alive, which is the number of animation graphs being run for every instance that opted into sharing. */
+	int32 GetNumBuckets() const { return Buckets.Num(); }
+
+private:
+	/* Adds the instance as a follower of the given bucket. */
+	void AddFollower(int32 BucketIndex, UPaperZDAnimInstance* Instance);
+
+	/* Releases every member of the bucket and removes it. */
+	void DissolveBucket(int32 BucketIndex);
+};
@@ -0,0 +1,98 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "PaperZDDirectionalitySubsystem.generated.h"
+
+class UPaperZDAnimInstance;
+class UPaperZDDirectionalitySubsystem;
+
+/**
+ * Tick function of the directionality subsystem, runs the batch once per frame after the movement of the actors.
+ */
+USTRUCT()
+struct FPaperZDDirectionalityTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/* Subsystem that owns this tick function. */
+	UPaperZDDirectionalitySubsystem* Subsystem = nullptr;
+
+	//~ Begin FTickFunction Interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+	//~ End FTickFunction Interface
+};
+
+template<>
+struct TStructOpsTypeTraits<FPaperZDDirectionalityTickFunction> : public TStructOpsTypeTraitsBase2<FPaperZDDirectionalityTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Resolves the facing direction of every AnimInstance that opted into batched directionality, once per frame on its own tick after movement (TG_PostPhysics).
+ * The velocity (or facing when idle) of the owning actors gets gathered into contiguous arrays, the angles and sectors are computed with SIMD for the whole batch,
+ * and the resulting sector is stabilized with hysteresis before being written into the instances, so the graph update of each instance only needs to read it.
+ */
+UCLASS()
+class PAPERZD_API UPaperZDDirectionalitySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/* Instances being resolved, indices are stored on the instances and kept up to date when removing entries. */
+	TArray<TWeakObjectPtr<UPaperZDAnimInstance>> Instances;
+
+	/* Direction of each entry on the 2D plane of its instance, padded to the SIMD width. */
+	TArray<float> InputX;
+	TArray<float> InputY;
+
+	/* Amount of sectors of each entry, taken from the sequence being played when it's multi-directional. */
+	TArray<int32> NumSectors;
+
+	/* Sector size of each entry, precomputed on gather so the batch doesn't have to divide. */
+	TArray<float> InvSectorSizes;
+
+	/* Angle offset of the sequence being played and the bias it results in, sectors are centered the same way the sequence bakes them. */
+	TArray<float> AngleOffsets;
+	TArray<float> SectorBiases;
+
+	/* Output of the batch, resolved angle in degrees and the raw (non-stabilized) sector. */
+	TArray<float> Angles;
+	TArray<float> RawSectors;
+
+	/* Runs the batch after the actors have moved. */
+	FPaperZDDirectionalityTickFunction TickFunction;
+
+public:
+	//~ Begin USubsystem Interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin UWorldSubsystem Interface
+	virtual void PostInitialize() override;
+	//~ End UWorldSubsystem Interface
+
+	/* Adds the instance to the batch. */
+	void RegisterInstance(UPaperZDAnimInstance* Instance);
+
+	/* Removes the instance from the batch. */
+	void UnregisterInstance(UPaperZDAnimInstance* Instance);
+
+	/* Resolves the direction of every registered instance. Called by the tick function of the subsystem. */
+	void ResolveDirections();
+
+	/* Number of instances currently being resolved. */
+	int32 GetNumInstances() const { return Instances.Num(); }
+
+private:
+	/* Removes the entry at the given index, fixing the index of the entry that takes its place. */
+	void RemoveEntryAt(int32 EntryIndex);
+};
@@ -0,0 +1,117 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PaperZDComponentReference.h"
+#include "AnimNodes/PaperZDAnimNode_RandomPlayer.h"
+#include "PaperZDSimplePlayerComponent.generated.h"
+
+class UPrimitiveComponent;
+class UPaperZDAnimSequence;
+
+/**
+ * Lightweight alternative to the Animation Blueprint for background actors (torches, idle NPCs, props) that only need to play a single sequence, or randomly pick from a small set.
+ * There is no AnimInstance, graph or notify processing involved: the component doesn't tick and every simple player of the world is driven from a single batched update.
+ */
+UCLASS(ClassGroup=(PaperZD), meta=(BlueprintSpawnableComponent, DisplayName = "PaperZD Simple Player"))
+class PAPERZD_API UPaperZDSimplePlayerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+	/* The batch writes the playback state back directly. */
+	friend class UPaperZDSimplePlayerSubsystem;
+
+	/* Render component to update. */
+	UPROPERTY(EditAnywhere, Category = "PaperZD", meta = (AllowAnyComponent, UseComponentPicker, AllowedClasses = "/Script/Engine.PrimitiveComponent"))
+	FPaperZDComponentReference RenderComponentRef;
+
+	/* Sequence to play, ignored if any random entry is set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Playback", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UPaperZDAnimSequence> AnimSequence;
+
+	/* If true, the sequence loops, otherwise it stays on its last frame once finished. Random entries always loop. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	bool bLooping;
+
+	/* Play rate of the sequence. Random entries pick their own play rate. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	float PlayRate;
+
+	/* If set, the player randomly picks the sequence to play from these entries, the same way the random player node does. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	TArray<FPaperZDRandomPlayerEntry> RandomEntries;
+
+	/* If true, playback starts at a random point of the sequence, so copies of the same prop placed together don't play in sync. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	bool bRandomStartTime;
+
+	/* If true, playback starts on BeginPlay. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	bool bPlayOnBeginPlay;
+
+	/* The directional angle to use with multi-directional sequences. */
+	UPROPERTY(EditAnywhere, Category = "Playback")
+	float DirectionalAngle;
+
+	/* If true, the render component is only updated while it's being rendered. Playback time keeps advancing regardless. */
+	UPROPERTY(EditAnywhere, Category = "Optimization")
+	bool bOnlyUpdateWhenRendered;
+
+	/* Index of our entry on the subsystem, INDEX_NONE while not playing. */
+	int32 EntryIndex;
+
+	/* Entry of the random list currently playing. */
+	int32 CurrentRandomEntryIndex;
+
+public:
+	//ctor
+	UPaperZDSimplePlayerComponent();
+
+	//~ Begin UActorComponent Interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End UActorComponent Interface
+
+	/* Starts playing from the beginning of the sequence (or a random point if requested). */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD")
+	void Play();
+
+	/* Stops playing, leaving the render component on the current frame. */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD")
+	void Stop();
+
+	/* True if the player is currently part of the batch. */
+	UFUNCTION(BlueprintPure, Category = "PaperZD")
+	bool IsPlaying() const { return EntryIndex != INDEX_NONE; }
+
+	/* Changes the sequence to play, restarting playback if already playing. Clears any random entry. */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD")
+	void SetAnimSequence(UPaperZDAnimSequence* InAnimSequence);
+
+	/* Changes the directional angle used with multi-directional sequences. */
+	UFUNCTION(BlueprintCallable, Category = "PaperZD")
+	void SetDirectionalAngle(float InDirectionalAngle);
+
+	/* Obtain the current playback time. */
+	UFUNCTION(BlueprintPure, Category = "PaperZD")
+	float GetPlaybackTime() const;
+
+	/* Obtain the sequence currently playing. */
+	UFUNCTION(BlueprintPure, Category = "PaperZD")
+	UPaperZDAnimSequence* GetCurrentAnimSequence() const;
+
+	/* Obtain the component we render into. */
+	UPrimitiveComponent* GetRenderComponent() const;
+
+	/* Sets the render component to use, use it on construction to set up the values for initialization. */
+	void InitRenderComponent(UPrimitiveComponent* InRenderComponent);
+
+private:
+	/* True if the player picks its sequences from the random entries. */
+	bool UsesRandomEntries() const;
+
+	/* Picks the next random entry to play, obtaining its play rate and the amount of loops to play it for. Returns false if no entry can be played. */
+	bool PickRandomEntry(float& OutPlayRate, int32& OutLoops);
+};
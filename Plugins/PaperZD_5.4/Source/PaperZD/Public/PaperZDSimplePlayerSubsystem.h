@@ -0,0 +1,85 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PaperZDSimplePlayerSubsystem.generated.h"
+
+class UPaperZDSimplePlayerComponent;
+class UPaperZDAnimSequence;
+class UPaperZDAnimationSource;
+class UPaperZDPlaybackHandle;
+class UPrimitiveComponent;
+
+/**
+ * Drives every simple player component of the world from a single update.
+ * The playback state is stored in contiguous arrays indexed by the entry of each player, so advancing the time of every player is a tight loop,
+ * and rendering goes through a single playback handle per animation source instead of an AnimPlayer per actor.
+ */
+UCLASS()
+class PAPERZD_API UPaperZDSimplePlayerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/* How the player behaves once it reaches the end of the sequence. */
+	enum class EEndBehavior : uint8
+	{
+		Loop,
+		Stop,
+		PickRandom
+	};
+
+	/* Playback state, one element per entry. */
+	TArray<TWeakObjectPtr<UPaperZDSimplePlayerComponent>> Players;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> RenderComponents;
+	TArray<const UPaperZDAnimSequence*> Sequences;
+	TArray<UPaperZDPlaybackHandle*> Handles;
+	TArray<float> PlaybackTimes;
+	TArray<float> PlayRates;
+	TArray<float> Durations;
+	TArray<int32> RemainingLoops;
+	TArray<EEndBehavior> EndBehaviors;
+
+	/* Playback handles shared by every player, one per animation source. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UPaperZDAnimationSource>, TObjectPtr<UPaperZDPlaybackHandle>> SharedHandles;
+
+public:
+	/* Obtain the subsystem for the world of the given object, if any. */
+	static UPaperZDSimplePlayerSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/* Adds the player to the batch, or restarts its playback if it was already part of it. */
+	void AddPlayer(UPaperZDSimplePlayerComponent* Player);
+
+	/* Removes the player from the batch. */
+	void RemovePlayer(UPaperZDSimplePlayerComponent* Player);
+
+	/* Obtain the playback time of the given entry. */
+	float GetPlaybackTime(int32 EntryIndex) const { return PlaybackTimes.IsValidIndex(EntryIndex) ? PlaybackTimes[EntryIndex] : 0.0f; }
+
+	/* Number of players currently being driven. */
+	int32 GetNumPlayers() const { return Players.Num(); }
+
+private:
+	/* Sets up the entry to start playing the sequence the player selected. Returns false if there's nothing to play. */
+	bool StartEntry(int32 EntryIndex, bool bRestart);
+
+	/* Removes the entry at the given index, fixing the index of the player that takes its place. */
+	void RemoveEntryAt(int32 EntryIndex);
+
+	/* Obtain the playback handle that renders the sequences of the given source, creating it if needed. */
+	UPaperZDPlaybackHandle* GetOrCreateHandle(UPaperZDAnimationSource* AnimSource);
+
+	/* Pushes the current state of the entry into its render component. Unless forced, components that aren't being rendered are skipped if the player allows it. */
+	void RenderEntry(int32 EntryIndex, bool bForce = false);
+};
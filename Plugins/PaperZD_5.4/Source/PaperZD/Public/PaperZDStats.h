@@ -2,6 +2,62 @@
 
 #pragma once
 #include "Stats/Stats.h"
+#include "HAL/PlatformTime.h"
 
 //Stat defines for PaperZD
 DECLARE_STATS_GROUP(TEXT("PaperZD"), STATGROUP_PaperZD, STATCAT_Advanced);
+
+/**
+ * Main runtime phases of the plugin, mirrored from the cycle stats so they can be measured without the stats system (i.e. headless benchmarks).
+ */
+enum class EPaperZDRuntimePhase : uint8
+{
+	UpdateAnimGraph,
+	RenderAnimations,
+	AnimNotifyTick,
+	Num
+};
+
+/**
+ * Cycle accumulators for the runtime phases. Only gathered while enabled, so the cost on a normal session is a single branch per scope.
+ * Notifies are processed while rendering, so the AnimNotifyTick phase is also contained inside the RenderAnimations phase.
+ */
+struct PAPERZD_API FPaperZDRuntimePhaseTimings
+{
+	/* If true, the phase scopes accumulate their cycles. */
+	static bool bEnabled;
+
+	/* Accumulated cycles per phase since the last reset. */
+	static uint64 Cycles[(int32)EPaperZDRuntimePhase::Num];
+
+	/* Clears every accumulator. */
+	static void Reset();
+
+	/* Obtain the time spent on the given phase since the last reset, in milliseconds. */
+	static double GetMilliseconds(EPaperZDRuntimePhase Phase);
+};
+
+/* Accumulates the time spent on the scope to the given phase. */
+struct FPaperZDScopedRuntimePhase
+{
+	EPaperZDRuntimePhase Phase;
+	uint64 StartCycles;
+
+	FPaperZDScopedRuntimePhase(EPaperZDRuntimePhase InPhase)
+		: Phase(InPhase)
+		, StartCycles(FPaperZDRuntimePhaseTimings::bEnabled ? FPlatformTime::Cycles64() : 0)
+	{}
+
+	~FPaperZDScopedRuntimePhase()
+	{
+		if (StartCycles)
+		{
+			FPaperZDRuntimePhaseTimings::Cycles[(int32)Phase] += FPlatformTime::Cycles64() - StartCycles;
+		}
+	}
+};
+
+/* Cycle stat that also feeds the runtime phase timings. */
+#define SCOPE_PAPERZD_PHASE_COUNTER(Stat, Phase) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	FPaperZDScopedRuntimePhase ANONYMOUS_VARIABLE(PaperZDPhase)(Phase)
@@ -0,0 +1,409 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#include "Commandlets/PaperZDBenchmarkCommandlet.h"
+#include "PaperZDAnimBP.h"
+#include "PaperZDAnimBPGeneratedClass.h"
+#include "PaperZDAnimInstance.h"
+#include "PaperZDStats.h"
+#include "AnimSequences/Players/PaperZDAnimPlayer.h"
+#include "AnimNodes/PaperZDAnimNode_PlaySequence.h"
+#include "AnimNodes/PaperZDAnimStateMachine.h"
+#include "PaperFlipbookComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "HAL/MemoryBase.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if ZD_VERSION_INLINED_CPP_SUPPORT
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PaperZDBenchmarkCommandlet)
+#endif
+
+namespace PaperZDBenchmark
+{
+	/**
+	 * Allocator proxy that counts the allocations done by the game thread while enabled.
+	 * Every call is forwarded to the allocator it replaces, so memory can be freed after the proxy is removed.
+	 */
+	class FCountingMalloc : public FMalloc
+	{
+		FMalloc* InnerMalloc;
+
+	public:
+		/* If true, game thread allocations will be counted. */
+		bool bCounting;
+
+		/* Number of allocations done since the last reset. */
+		int64 NumAllocations;
+
+	public:
+		//ctor
+		FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+			, bCounting(false)
+			, NumAllocations(0)
+		{}
+
+		FMalloc* GetInnerMalloc() const { return InnerMalloc; }
+
+		// ~FMalloc
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		// ~FMalloc
+
+	private:
+		FORCEINLINE void CountAllocation()
+		{
+			if (bCounting && IsInGameThread())
+			{
+				NumAllocations++;
+			}
+		}
+	};
+
+	/* Data gathered for a single benchmark frame. */
+	struct FFrameSample
+	{
+		double UpdateAnimGraphMs = 0.0;
+		double RenderAnimationsMs = 0.0;
+		double AnimNotifyTickMs = 0.0;
+		double TotalMs = 0.0;
+		int64 Allocations = 0;
+		int32 Jumps = 0;
+		int32 Overrides = 0;
+	};
+
+	/* Jump link that can be taken on the benchmark AnimBP. */
+	struct FJumpTarget
+	{
+		FName MachineName;
+		FName JumpName;
+	};
+
+	/* Assigns a random value to the given blueprint variable. */
+	void RandomizeVariable(FProperty* Property, UObject* Object, FRandomStream& Stream)
+	{
+		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+		if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			BoolProperty->SetPropertyValue(ValuePtr, Stream.FRand() < 0.5f);
+		}
+		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			if (NumericProperty->IsFloatingPoint())
+			{
+				NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Stream.FRandRange(-1000.0f, 1000.0f));
+			}
+			else if (!NumericProperty->IsEnum())
+			{
+				NumericProperty->SetIntPropertyValue(ValuePtr, (int64)Stream.RandRange(0, 10));
+			}
+		}
+	}
+}
+
+AActor* UPaperZDBenchmarkInstanceManager::GetOwningActor() const
+{
+	return OwningActor;
+}
+
+UPrimitiveComponent* UPaperZDBenchmarkInstanceManager::GetRenderComponent() const
+{
+	return RenderComponent;
+}
+
+UWorld* UPaperZDBenchmarkInstanceManager::OnGetWorld() const
+{
+	return OwningActor ? OwningActor->GetWorld() : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//// Benchmark Commandlet
+//////////////////////////////////////////////////////////////////////////
+UPaperZDBenchmarkCommandlet::UPaperZDBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UPaperZDBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PaperZDBenchmark;
+
+	//Parse the settings
+	FString AnimBPPath;
+	if (!FParse::Value(*Params, TEXT("AnimBP="), AnimBPPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("PaperZDBenchmark: No AnimBP specified, use -AnimBP=/Game/Path/To/AnimBP"));
+		return 1;
+	}
+
+	int32 NumInstances = 100;
+	int32 NumFrames = 600;
+	int32 Seed = 0;
+	float DeltaTime = 1.0f / 60.0f;
+	float JumpChance = 0.01f;
+	float OverrideChance = 0.005f;
+	float VariableChance = 0.05f;
+	float FixedTimestep = 0.0f;
+	int32 WarmupFrames = 2;
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("Instances="), NumInstances);
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("DeltaTime="), DeltaTime);
+	FParse::Value(*Params, TEXT("JumpChance="), JumpChance);
+	FParse::Value(*Params, TEXT("OverrideChance="), OverrideChance);
+	FParse::Value(*Params, TEXT("VariableChance="), VariableChance);
+	FParse::Value(*Params, TEXT("FixedTimestep="), FixedTimestep);
+	FParse::Value(*Params, TEXT("WarmupFrames="), WarmupFrames);
+	const bool bExpectNoAllocations = FParse::Param(*Params, TEXT("ExpectNoAllocations"));
+	NumInstances = FMath::Max(NumInstances, 1);
+	NumFrames = FMath::Max(NumFrames, 1);
+
+	UPaperZDAnimBP* AnimBP = LoadObject<UPaperZDAnimBP>(nullptr, *AnimBPPath);
+	UPaperZDAnimBPGeneratedClass* AnimClass = AnimBP ? Cast<UPaperZDAnimBPGeneratedClass>(AnimBP->GeneratedClass) : nullptr;
+	if (!AnimClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PaperZDBenchmark: Could not load a compiled AnimBP at '%s'"), *AnimBPPath);
+		return 1;
+	}
+
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("PaperZD") / FString::Printf(TEXT("Benchmark_%s_%s.csv"), *AnimBP->GetName(), *FDateTime::Now().ToString());
+	}
+
+	//Gather the scripted inputs that can be driven on this AnimBP
+	TArray<FProperty*> Variables;
+	for (TFieldIterator<FProperty> It(AnimClass); It; ++It)
+	{
+		FProperty* Property = *It;
+		const bool bBlueprintVariable = Cast<UBlueprintGeneratedClass>(Property->GetOwnerClass()) != nullptr && Property->HasAnyPropertyFlags(CPF_BlueprintVisible);
+		if (bBlueprintVariable && (Property->IsA<FBoolProperty>() || Property->IsA<FNumericProperty>()))
+		{
+			Variables.Add(Property);
+		}
+	}
+
+	TArray<FJumpTarget> JumpTargets;
+	for (const FPaperZDAnimStateMachine& StateMachine : AnimClass->GetStateMachines())
+	{
+		for (const TPair<FName, int32>& JumpLink : StateMachine.JumpLinks)
+		{
+			JumpTargets.Add({ StateMachine.MachineName, JumpLink.Key });
+		}
+	}
+
+	TArray<FName> OverrideSlots;
+	AnimClass->GetOverrideSlotDescriptors().GenerateKeyArray(OverrideSlots);
+
+	TArray<UPaperZDAnimSequence*> OverrideSequences;
+	UObject* DefaultObject = AnimClass->GetDefaultObject();
+	for (TFieldIterator<FStructProperty> It(AnimClass); It; ++It)
+	{
+		if (It->Struct->IsChildOf(FPaperZDAnimNode_PlaySequence::StaticStruct()))
+		{
+			const FPaperZDAnimNode_PlaySequence* PlayNode = It->ContainerPtrToValuePtr<FPaperZDAnimNode_PlaySequence>(DefaultObject);
+			if (PlayNode->GetAnimSequence())
+			{
+				OverrideSequences.AddUnique(PlayNode->GetAnimSequence());
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PaperZDBenchmark: Running '%s' with %d instances for %d frames (%d variables, %d jump links, %d override slots, %d sequences)"),
+		*AnimBP->GetName(), NumInstances, NumFrames, Variables.Num(), JumpTargets.Num(), OverrideSlots.Num(), OverrideSequences.Num());
+
+	//Create a game world for the instances to live in
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PaperZDBenchmark"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	//Spawn the instances against off-screen flipbook components
+	TArray<UPaperZDAnimInstance*> Instances;
+	TArray<UPaperZDBenchmarkInstanceManager*> Managers;
+	for (int32 i = 0; i < NumInstances; i++)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		UPaperFlipbookComponent* RenderComponent = NewObject<UPaperFlipbookComponent>(Actor);
+		Actor->SetRootComponent(RenderComponent);
+		RenderComponent->RegisterComponent();
+
+		UPaperZDBenchmarkInstanceManager* Manager = NewObject<UPaperZDBenchmarkInstanceManager>(GetTransientPackage());
+		Manager->OwningActor = Actor;
+		Manager->RenderComponent = RenderComponent;
+		Manager->AddToRoot();
+		Managers.Add(Manager);
+
+		UPaperZDAnimInstance* Instance = NewObject<UPaperZDAnimInstance>(Manager, AnimClass);
+		Instance->Init(Manager);
+		Instances.Add(Instance);
+
+		if (FixedTimestep > 0.0f)
+		{
+			Instance->GetPlayer()->bUseFixedTimestep = true;
+			Instance->GetPlayer()->FixedTimestep = FixedTimestep;
+		}
+	}
+
+	//Run the benchmark, allocations are only counted while the instances tick
+	FRandomStream Stream(Seed);
+	TArray<FFrameSample> Samples;
+	Samples.Reserve(NumFrames);
+
+	FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+	GMalloc = CountingMalloc;
+
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+		for (UPaperZDAnimInstance* Instance : Instances)
+		{
+			for (FProperty* Variable : Variables)
+			{
+				if (Stream.FRand() < VariableChance)
+				{
+					RandomizeVariable(Variable, Instance, Stream);
+				}
+			}
+
+			if (JumpTargets.Num() && Stream.FRand() < JumpChance)
+			{
+				const FJumpTarget& Target = JumpTargets[Stream.RandRange(0, JumpTargets.Num() - 1)];
+				Instance->JumpToNode(Target.JumpName, Target.MachineName);
+				Sample.Jumps++;
+			}
+
+			if (OverrideSlots.Num() && OverrideSequences.Num() && Stream.FRand() < OverrideChance)
+			{
+				UPaperZDAnimSequence* Sequence = OverrideSequences[Stream.RandRange(0, OverrideSequences.Num() - 1)];
+				const FName SlotName = OverrideSlots[Stream.RandRange(0, OverrideSlots.Num() - 1)];
+				if (Instance->PlayAnimationOverride(Sequence, SlotName))
+				{
+					Sample.Overrides++;
+				}
+			}
+		}
+
+		//Nodes like the animation cache rely on the engine frame counter
+		GFrameNumber++;
+
+		FPaperZDRuntimePhaseTimings::Reset();
+		FPaperZDRuntimePhaseTimings::bEnabled = true;
+		CountingMalloc->NumAllocations = 0;
+		CountingMalloc->bCounting = true;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (UPaperZDAnimInstance* Instance : Instances)
+		{
+			Instance->Tick(DeltaTime);
+		}
+
+		Sample.TotalMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		CountingMalloc->bCounting = false;
+		FPaperZDRuntimePhaseTimings::bEnabled = false;
+		Sample.Allocations = CountingMalloc->NumAllocations;
+		Sample.UpdateAnimGraphMs = FPaperZDRuntimePhaseTimings::GetMilliseconds(EPaperZDRuntimePhase::UpdateAnimGraph);
+		Sample.RenderAnimationsMs = FPaperZDRuntimePhaseTimings::GetMilliseconds(EPaperZDRuntimePhase::RenderAnimations);
+		Sample.AnimNotifyTickMs = FPaperZDRuntimePhaseTimings::GetMilliseconds(EPaperZDRuntimePhase::AnimNotifyTick);
+	}
+
+	//The proxy is leaked on purpose, allocations done while it was installed might still be freed through it by other threads
+	GMalloc = CountingMalloc->GetInnerMalloc();
+
+	//Teardown
+	for (UPaperZDBenchmarkInstanceManager* Manager : Managers)
+	{
+		Manager->RemoveFromRoot();
+	}
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	//Write the results
+	FString Csv = TEXT("Frame,UpdateAnimGraphMs,RenderAnimationsMs,AnimNotifyTickMs,TotalMs,Allocations,Jumps,Overrides\n");
+	double SumTotalMs = 0.0;
+	double MaxTotalMs = 0.0;
+	int64 SumAllocations = 0;
+	int64 SteadyAllocations = 0;
+	int32 NumSteadyFrames = 0;
+	int32 NumAllocatingSteadyFrames = 0;
+	for (int32 Frame = 0; Frame < Samples.Num(); Frame++)
+	{
+		const FFrameSample& Sample = Samples[Frame];
+		Csv += FString::Printf(TEXT("%d,%.4f,%.4f,%.4f,%.4f,%lld,%d,%d\n"), Frame, Sample.UpdateAnimGraphMs, Sample.RenderAnimationsMs, Sample.AnimNotifyTickMs, Sample.TotalMs, Sample.Allocations, Sample.Jumps, Sample.Overrides);
+		SumTotalMs += Sample.TotalMs;
+		MaxTotalMs = FMath::Max(MaxTotalMs, Sample.TotalMs);
+		SumAllocations += Sample.Allocations;
+
+		//Jumps and overrides legitimately allocate on the frame they happen (new states, override slots), everything else shouldn't
+		if (Frame >= WarmupFrames && Sample.Jumps == 0 && Sample.Overrides == 0)
+		{
+			NumSteadyFrames++;
+			SteadyAllocations += Sample.Allocations;
+			if (Sample.Allocations > 0)
+			{
+				NumAllocatingSteadyFrames++;
+			}
+		}
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("PaperZDBenchmark: Could not write results to '%s'"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PaperZDBenchmark: Average frame %.4f ms (max %.4f ms), %.1f allocations per frame. Results written to '%s'"),
+		SumTotalMs / Samples.Num(), MaxTotalMs, (double)SumAllocations / Samples.Num(), *OutputPath);
+
+	UE_LOG(LogTemp, Display, TEXT("PaperZDBenchmark: %lld allocations over %d steady state frames, %d of them allocated"),
+		SteadyAllocations, NumSteadyFrames, NumAllocatingSteadyFrames);
+
+	if (bExpectNoAllocations && NumAllocatingSteadyFrames > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PaperZDBenchmark: Expected no allocations on steady state frames, see the Allocations column in '%s'"), *OutputPath);
+		return 1;
+	}
+
+	return 0;
+}
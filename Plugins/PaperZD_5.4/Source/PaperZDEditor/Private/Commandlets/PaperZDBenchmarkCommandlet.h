@@ -0,0 +1,56 @@
+// Copyright 2017 ~ 2022 Critical Failure Studio Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "IPaperZDAnimInstanceManager.h"
+#include "PaperZDBenchmarkCommandlet.generated.h"
+
+class UPaperFlipbookComponent;
+
+/**
+ * Minimal manager used to drive the AnimInstances spawned by the benchmark, owns an off-screen flipbook component.
+ */
+UCLASS(Transient)
+class UPaperZDBenchmarkInstanceManager : public UObject, public IPaperZDAnimInstanceManager
+{
+	GENERATED_BODY()
+
+public:
+	/* Actor that owns the render component. */
+	UPROPERTY()
+	TObjectPtr<AActor> OwningActor;
+
+	/* Off-screen component the AnimPlayer renders into. */
+	UPROPERTY()
+	TObjectPtr<UPaperFlipbookComponent> RenderComponent;
+
+	// ~IPaperZDAnimInstanceManager
+	virtual AActor* GetOwningActor() const override;
+	virtual UPrimitiveComponent* GetRenderComponent() const override;
+	virtual UWorld* OnGetWorld() const override;
+	// ~IPaperZDAnimInstanceManager
+};
+
+/**
+ * Headless benchmark for the PaperZD runtime.
+ * Spawns a number of AnimInstances of the given AnimBP, drives them with scripted variable changes, jumps and overrides and writes the per-frame cost of each runtime phase to a CSV file.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=PaperZDBenchmark -AnimBP=/Game/Path/To/AnimBP -nullrhi
+ * Optional: -Instances=100 -Frames=600 -DeltaTime=0.0166 -Seed=0 -JumpChance=0.01 -OverrideChance=0.005 -VariableChance=0.05 -FixedTimestep=0.0166 -WarmupFrames=2 -ExpectNoAllocations -Output=<File.csv>
+ * Steady state frames (past the warmup, without jumps or overrides) are expected not to allocate, -ExpectNoAllocations turns any allocation on them into a failure.
+ */
+UCLASS()
+class UPaperZDBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	//ctor
+	UPaperZDBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
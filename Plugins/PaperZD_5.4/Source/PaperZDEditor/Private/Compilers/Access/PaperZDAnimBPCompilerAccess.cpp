@@ -92,3 +92,10 @@ FOnProcessAnimationNodesSignature& FPaperZDAnimBPCompilerAccess::OnPostProcessAn
 {
 	return CompilerContext->OnPostProcessAnimationNodes;
 }
+
+void FPaperZDAnimBPCompilerAccess::AddCompileTiming(FName Section, double Seconds)
+{
+	TPair<double, int32>& Timing = CompilerContext->CompileTimings.FindOrAdd(Section, TPair<double, int32>(0.0, 0));
+	Timing.Key += Seconds;
+	Timing.Value++;
+}
@@ -104,4 +104,30 @@ public:
 
 	/* Delegate called after the animation nodes have been processed. */
 	FOnProcessAnimationNodesSignature& OnPostProcessAnimationNodes();
+
+	/* Adds the given time to the section on the compilation timing breakdown. */
+	void AddCompileTiming(FName Section, double Seconds);
+};
+
+/**
+ * Measures the time spent on its scope and adds it to the compilation timing breakdown.
+ */
+class FPaperZDScopedCompileTimer
+{
+	FPaperZDAnimBPCompilerAccess& CompilerAccess;
+	FName Section;
+	double StartTime;
+
+public:
+	//ctor
+	FPaperZDScopedCompileTimer(FPaperZDAnimBPCompilerAccess& InCompilerAccess, FName InSection)
+		: CompilerAccess(InCompilerAccess)
+		, Section(InSection)
+		, StartTime(FPlatformTime::Seconds())
+	{}
+
+	~FPaperZDScopedCompileTimer()
+	{
+		CompilerAccess.AddCompileTiming(Section, FPlatformTime::Seconds() - StartTime);
+	}
 };
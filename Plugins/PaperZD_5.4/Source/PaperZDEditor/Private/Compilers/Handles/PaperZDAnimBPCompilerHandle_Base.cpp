@@ -97,6 +97,8 @@ void FPaperZDAnimBPCompilerHandle_Base::Initialize(FPaperZDAnimBPCompilerAccess&
 
 void FPaperZDAnimBPCompilerHandle_Base::AddStructEvalHandlers(UPaperZDAnimGraphNode_Base* InNode, FPaperZDAnimBPCompilerAccess& InCompilerContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilerContext, TEXT("BaseHandle.AddStructEvalHandlers"));
+
 	const UPaperZDAnimGraphSchema* AnimGraphDefaultSchema = GetDefault<UPaperZDAnimGraphSchema>();
 	FEvaluationHandlerRecord& EvalHandler = PerNodeStructEvalHandlers.Add(InNode);
 
@@ -330,6 +332,8 @@ void FPaperZDAnimBPCompilerHandle_Base::CreateEvaluationHandler(FPaperZDAnimBPCo
 
 void FPaperZDAnimBPCompilerHandle_Base::FinishCompilingClass(const UClass* InClass, FPaperZDAnimBPCompilerAccess& InCompilerContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilerContext, TEXT("BaseHandle.FinishCompilingClass"));
+
 	// Without the property access system we need to patch generated function names here
 	// Create one exposed handler per HandlerRecord (pass the function information onto the CLASS)
 	TArray<FPaperZDExposedValueHandler>& ExposedValueHandlers = OutCompiledData.GetExposedValueHandlers();
@@ -343,6 +347,8 @@ void FPaperZDAnimBPCompilerHandle_Base::FinishCompilingClass(const UClass* InCla
 
 void FPaperZDAnimBPCompilerHandle_Base::CopyTermDefaultsToDefaultObject(UObject* InDefaultObject, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilationContext, TEXT("BaseHandle.CopyTermDefaults"));
+
 	UPaperZDAnimInstance* AnimInstance = Cast<UPaperZDAnimInstance>(InDefaultObject);
 	if (AnimInstance)
 	{
@@ -16,6 +16,8 @@ void FPaperZDAnimBPCompilerHandle_CacheAnimation::Initialize(FPaperZDAnimBPCompi
 
 void FPaperZDAnimBPCompilerHandle_CacheAnimation::PreProcessAnimationNodes(TArrayView<UPaperZDAnimGraphNode_Base*> InAnimNodes, FPaperZDAnimBPCompilerAccess& InCompilerAccess, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilerAccess, TEXT("CacheAnimationHandle.PreProcessAnimationNodes"));
+
 	//Gather every cache animation node for later referral with their "UseCachedAnimation" node counterpart.
 	for (UPaperZDAnimGraphNode_Base* Node : InAnimNodes)
 	{
@@ -28,6 +30,8 @@ void FPaperZDAnimBPCompilerHandle_CacheAnimation::PreProcessAnimationNodes(TArra
 
 void FPaperZDAnimBPCompilerHandle_CacheAnimation::PostProcessAnimationNodes(TArrayView<UPaperZDAnimGraphNode_Base*> InAnimNodes, FPaperZDAnimBPCompilerAccess& InCompilerAccess, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilerAccess, TEXT("CacheAnimationHandle.PostProcessAnimationNodes"));
+
 	//Do a sanity check against the Cache and Use nodes, to make sure there are no circular references inside.
 	CheckForCircularReferences(InCompilerAccess);
 }
@@ -20,6 +20,8 @@ void FPaperZDAnimBPCompilerHandle_StateMachine::Initialize(FPaperZDAnimBPCompile
 
 int32 FPaperZDAnimBPCompilerHandle_StateMachine::ProcessAnimationGraph(UEdGraph* SourceGraph, UPaperZDAnimGraphNode_Base* SourceRootNode, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilationContext, TEXT("StateMachineHandle.ProcessAnimationGraph"));
+
 	//Because the inner AnimationGraphs (inside the state nodes and transitional nodes) are not processed in the "MergeUbergraphPagesIn" method of the compiler
 	//due to them being inside the StateMachine nodes, this method will re-create the steps needed for the nodes to be added to the consolidated event graph
 	//and be processed as they should.
@@ -70,6 +72,8 @@ int32 FPaperZDAnimBPCompilerHandle_StateMachine::ProcessAnimationGraph(UEdGraph*
 
 void FPaperZDAnimBPCompilerHandle_StateMachine::ProcessTransitionGraph(UEdGraph* SourceGraph, FPaperZDAnimStateMachineTransitionRule& OutTransitionRule, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilationContext, TEXT("StateMachineHandle.ProcessTransitionGraph"));
+
 	UPaperZDTransitionGraphNode_Result* ResultNode = CastChecked<UPaperZDAnimTransitionGraph>(SourceGraph)->GetResultNode();
 	check(ResultNode && ResultNode->Pins.Num());
 	UEdGraphPin* ResultPin = ResultNode->Pins[0];
@@ -113,6 +117,7 @@ void FPaperZDAnimBPCompilerHandle_StateMachine::ProcessTransitionGraph(UEdGraph*
 		//Finally fill the data
 		OutTransitionRule.bDynamicRule = true;
 		OutTransitionRule.RuleFunctionName = FunctionEntry->CustomGeneratedFunctionName;
+		NumDynamicRules++;
 	}
 	else
 	{
@@ -120,29 +125,40 @@ void FPaperZDAnimBPCompilerHandle_StateMachine::ProcessTransitionGraph(UEdGraph*
 		//Fast path the value and copy it directly to the transition rule
 		OutTransitionRule.bDynamicRule = false;
 		OutTransitionRule.bConstantValue = ResultPin->GetDefaultAsString().ToBool();
+		NumConstantRules++;
 	}
 }
 
 void FPaperZDAnimBPCompilerHandle_StateMachine::HandleStartCompilingClass(const UClass* InClass, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
 	AnimGetterNodes.Empty();
+	UsedFunctionNames.Reset();
+	NumScannedFunctionGraphs = 0;
+	bScannedBlueprintFunctions = false;
+	NumDynamicRules = 0;
+	NumConstantRules = 0;
 }
 
 void FPaperZDAnimBPCompilerHandle_StateMachine::PostProcessAnimationNodes(TArrayView<UPaperZDAnimGraphNode_Base*> InAnimNodes, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData)
 {
+	FPaperZDScopedCompileTimer Timer(InCompilationContext, TEXT("StateMachineHandle.PostProcessAnimationNodes"));
+
 	//Check every found AnimGetter node and wire them up internally if they are valid
 	for (UPaperZDK2Node_AnimGetter* AnimGetter : AnimGetterNodes)
 	{
 		AutoWireAnimGetter(AnimGetter, InCompilationContext, OutCompiledData);
 	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("PaperZD: '%s' transition rules: %d dynamic, %d constant"), *InCompilationContext.GetAnimBP()->GetName(), NumDynamicRules, NumConstantRules);
 }
 
-FName FPaperZDAnimBPCompilerHandle_StateMachine::GenerateValidTransitionFunctionName(FPaperZDAnimBPCompilerAccess& InCompilationContext, const FString& InBaseName) const
+void FPaperZDAnimBPCompilerHandle_StateMachine::GatherUsedFunctionNames(FPaperZDAnimBPCompilerAccess& InCompilationContext)
 {
-	//First create a set of the generated function graphs that have custom generated function names
-	TSet<FName> FunctionNames;
-	for (const UEdGraph* Graph : InCompilationContext.GetGeneratedFunctionGraphs())
+	//Add the generated function graphs that have custom generated function names, only looking at the ones we haven't seen yet
+	const TArray<UEdGraph*>& GeneratedFunctionGraphs = InCompilationContext.GetGeneratedFunctionGraphs();
+	for (; NumScannedFunctionGraphs < GeneratedFunctionGraphs.Num(); NumScannedFunctionGraphs++)
 	{
+		const UEdGraph* Graph = GeneratedFunctionGraphs[NumScannedFunctionGraphs];
 		//Find the function entry node
 		TArray<UK2Node_FunctionEntry*> FunctionEntries;
 		Graph->GetNodesOfClass(FunctionEntries);
@@ -153,19 +169,28 @@ FName FPaperZDAnimBPCompilerHandle_StateMachine::GenerateValidTransitionFunction
 			UK2Node_FunctionEntry* EntryNode = FunctionEntries[0];
 			if (EntryNode->CustomGeneratedFunctionName != NAME_None)
 			{
-				FunctionNames.Add(EntryNode->CustomGeneratedFunctionName);
+				UsedFunctionNames.Add(EntryNode->CustomGeneratedFunctionName);
 			}
 		}
 	}
 
-	//Fill with the actual used names of the functions
-	FBlueprintEditorUtils::GetFunctionNameList(InCompilationContext.GetAnimBP(), FunctionNames);
+	//Fill with the actual used names of the functions, these don't change while compiling
+	if (!bScannedBlueprintFunctions)
+	{
+		FBlueprintEditorUtils::GetFunctionNameList(InCompilationContext.GetAnimBP(), UsedFunctionNames);
+		bScannedBlueprintFunctions = true;
+	}
+}
+
+FName FPaperZDAnimBPCompilerHandle_StateMachine::GenerateValidTransitionFunctionName(FPaperZDAnimBPCompilerAccess& InCompilationContext, const FString& InBaseName)
+{
+	GatherUsedFunctionNames(InCompilationContext);
 
 	//Need to manually validate the function names, as the GeneratedFunctionNames haven't created a function stub yet, hence they will collide if two of the transitions have the same name
 	//This is very probable and non-avoidable when there are nested state machines, as they only generate unique names from their own scope
 	FString TestString = InBaseName;
 	int32 Count = 0;
-	while (FunctionNames.Contains(*TestString))
+	while (UsedFunctionNames.Contains(*TestString))
 	{
 		TestString = FString::Printf(TEXT("%s_%d"), *InBaseName, Count);
 		Count++;
@@ -24,6 +24,19 @@ class FPaperZDAnimBPCompilerHandle_StateMachine : public IPaperZDAnimBPCompilerH
 	/* List of AnimGetters that were found on the state machine. */
 	TArray<UPaperZDK2Node_AnimGetter*> AnimGetterNodes;
 
+	/* Function names already taken on this compilation, filled incrementally as new function graphs get generated. */
+	TSet<FName> UsedFunctionNames;
+
+	/* Amount of generated function graphs that were already added to the used function names. */
+	int32 NumScannedFunctionGraphs = 0;
+
+	/* True once the blueprint function names were added to the used function names. */
+	bool bScannedBlueprintFunctions = false;
+
+	/* Transition rules compiled into a function, and the ones fast-pathed to a constant value. */
+	int32 NumDynamicRules = 0;
+	int32 NumConstantRules = 0;
+
 public:
 	//~Begin IPaperZDAnimBPCompilerHandle Interface
 	virtual void Initialize(FPaperZDAnimBPCompilerAccess& InCompilerAccess) override;
@@ -43,7 +56,10 @@ public:
 
 private:
 	/* Generates a valid transition function name that doesn't collide with any kismet name nor any generated function name. */
-	FName GenerateValidTransitionFunctionName(FPaperZDAnimBPCompilerAccess& InCompilationContext, const FString& InBaseName) const;
+	FName GenerateValidTransitionFunctionName(FPaperZDAnimBPCompilerAccess& InCompilationContext, const FString& InBaseName);
+
+	/* Updates the used function name set with any function graph generated since the last call. */
+	void GatherUsedFunctionNames(FPaperZDAnimBPCompilerAccess& InCompilationContext);
 
 	/* Wires an AnimGetter node. */
 	void AutoWireAnimGetter(UPaperZDK2Node_AnimGetter* AnimGetter, FPaperZDAnimBPCompilerAccess& InCompilationContext, FPaperZDAnimBPGeneratedClassAccess& OutCompiledData);
@@ -150,6 +150,9 @@ void FPaperZDAnimBPCompilerContext::UpdateAnimNotifyFunctions()
 		return;
 	}
 
+	//Bake the registered notifies, the source only stores them as editor data and the runtime needs them to index every notify
+	NewAnimBlueprintClass->RegisteredNotifyNames = AnimBP->GetSupportedAnimationSource()->GetRegisteredNotifyNames();
+
 	//We will map any notify function to its corresponding name on the class, so they can be found easily when running the notify events
 	for (int32 i = 0; i < AnimBP->FunctionGraphs.Num(); i++)
 	{
@@ -237,6 +240,8 @@ void FPaperZDAnimBPCompilerContext::GetLinkedAnimNodes_ProcessAnimNode(UPaperZDA
 void FPaperZDAnimBPCompilerContext::MergeUbergraphPagesIn(UEdGraph* Ubergraph)
 {
 	FKismetCompilerContext::MergeUbergraphPagesIn(Ubergraph);
+	FPaperZDAnimBPCompilerAccess TimerAccess(this);
+	FPaperZDScopedCompileTimer Timer(TimerAccess, TEXT("Context.MergeAnimationGraph"));
 
 	//We don't have support for inheriting classes, but if we had, this is the point where we would avoid merging pages.
 	{
@@ -472,12 +477,15 @@ void FPaperZDAnimBPCompilerContext::ProcessAnimationNode(UPaperZDAnimGraphNode_B
 
 	FPaperZDAnimBPCompilerAccess CompilerAccess(this);
 	FPaperZDAnimBPGeneratedClassAccess ClassAccess(NewAnimBlueprintClass);
+	FPaperZDScopedCompileTimer Timer(CompilerAccess, VisualAnimNode->GetClass()->GetFName());
 	VisualAnimNode->ProcessDuringCompilation(CompilerAccess, ClassAccess);
 }
 
 void FPaperZDAnimBPCompilerContext::CopyTermDefaultsToDefaultObject(UObject* DefaultObject)
 {
 	FKismetCompilerContext::CopyTermDefaultsToDefaultObject(DefaultObject);
+	FPaperZDAnimBPCompilerAccess TimerAccess(this);
+	FPaperZDScopedCompileTimer Timer(TimerAccess, TEXT("Context.CopyTermDefaults"));
 
 	//Bake the data onto the AnimInstance
 	UPaperZDAnimInstance* AnimInstance = Cast<UPaperZDAnimInstance>(DefaultObject);
@@ -553,6 +561,9 @@ void FPaperZDAnimBPCompilerContext::CopyTermDefaultsToDefaultObject(UObject* Def
 
 void FPaperZDAnimBPCompilerContext::PreCompile()
 {
+	CompileTimings.Reset();
+	CompileStartTime = FPlatformTime::Seconds();
+
 	//Let the AnimBP know that it's gonna be compiled, so it prepares its graphs
 	AnimBP->OnPreCompile();
 }
@@ -568,6 +579,21 @@ void FPaperZDAnimBPCompilerContext::PostCompile()
 
 	//Let the AnimBP know that we finished compilation
 	AnimBP->OnPostCompile();
+	LogCompileTimings();
+}
+
+void FPaperZDAnimBPCompilerContext::LogCompileTimings() const
+{
+	const double TotalTime = FPlatformTime::Seconds() - CompileStartTime;
+	UE_LOG(LogTemp, Verbose, TEXT("PaperZD: Compiled '%s' in %.2f ms"), *AnimBP->GetName(), TotalTime * 1000.0);
+
+	//Slowest sections first
+	TArray<TPair<FName, TPair<double, int32>>> SortedTimings = CompileTimings.Array();
+	SortedTimings.Sort([](const TPair<FName, TPair<double, int32>>& A, const TPair<FName, TPair<double, int32>>& B) { return A.Value.Key > B.Value.Key; });
+	for (const TPair<FName, TPair<double, int32>>& Timing : SortedTimings)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("    %s: %.2f ms (%d calls)"), *Timing.Key.ToString(), Timing.Value.Key * 1000.0, Timing.Value.Value);
+	}
 }
 
 void FPaperZDAnimBPCompilerContext::EnsureProperGeneratedClass(UClass*& InTargetClass)
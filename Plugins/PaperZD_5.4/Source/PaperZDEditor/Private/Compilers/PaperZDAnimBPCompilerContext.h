@@ -63,6 +63,12 @@ class FPaperZDAnimBPCompilerContext : public FKismetCompilerContext
 	//AnimData LinkRecords for later patch-up
 	TArray<FPaperZDAnimDataLinkRecord> LinkRecords;
 
+	/* Time in seconds and number of runs of each timed section of the compilation, logged once the compilation ends. Sections are inclusive of any nested one. */
+	TMap<FName, TPair<double, int32>> CompileTimings;
+
+	/* Time at which the compilation started. */
+	double CompileStartTime = 0.0;
+
 public:
 	//ctor
 	FPaperZDAnimBPCompilerContext(UBlueprint* Blueprint, FCompilerResultsLog& InMessageLog, const FKismetCompilerOptions& InCompilerOptions);
@@ -133,6 +139,9 @@ private:
 	/* Updates the AnimNotify function list. */
 	void UpdateAnimNotifyFunctions();
 
+	/* Logs the time spent on the compilation, broken down per timed section. */
+	void LogCompileTimings() const;
+
 	/* Gets all anim graph nodes that are piped into the provided node (traverses input pins). */
 	void GetLinkedAnimNodes(UPaperZDAnimGraphNode_Base* InGraphNode, TArray<UPaperZDAnimGraphNode_Base*>& LinkedAnimNodes) const;
 	void GetLinkedAnimNodes_TraversePin(UEdGraphPin* InPin, TArray<UPaperZDAnimGraphNode_Base*>& LinkedAnimNodes) const;
@@ -266,6 +266,17 @@ class SPaperZDAnimNotifyNode : public SLeafWidget
 	/* Updates the widget visuals. */
 	void UpdateSizeAndPosition(const FGeometry& AllottedGeometry);
 
+	/* Measures the label of the notify, only when its name changed since the last measure. */
+	void UpdateLabelSize();
+
+	/* True if any part of the node would be visible when the track displays the given time range. */
+	bool IsInViewRange(float InViewMin, float InViewMax, float PixelsPerInput);
+
+	/* Sets whether the node is inside the visible range of the track. Nodes outside of it are collapsed, so they don't get arranged, painted nor hit-tested. */
+	void SetInViewRange(bool bInViewRange) { bIsInViewRange = bInViewRange; }
+	bool IsInViewRange() const { return bIsInViewRange; }
+	EVisibility GetNodeVisibility() const { return bIsInViewRange || bBeingDragged ? EVisibility::Visible : EVisibility::Collapsed; }
+
 	/* Returns the size of this widget. */
  	const FVector2D& GetSize() const { return Size; }
 
@@ -357,6 +368,7 @@ private:
 
 	bool bBeingDragged;
 	bool bDrawTooltipToRight;
+	bool bIsInViewRange;
 
 	TSharedPtr<SOverlay> EndMarkerNodeOverlay;
 
@@ -364,6 +376,9 @@ private:
 	FVector2D TextSize;
 	float LabelWidth;
 
+	/* Name the label was last measured with. */
+	FName MeasuredLabelName;
+
 	//Slate Events
 	FOnNotifyNodeDragStarted		OnNodeDragStarted;
 	FOnDeselectAllNotifies			OnDeselectAllNotifies;
@@ -599,6 +614,9 @@ private:
 	/* Notify node objects that live inside this track. */
 	TArray<TSharedPtr<SPaperZDAnimNotifyNode>> NotifyNodes;
 
+	/* Indices of the nodes that were inside the view range on the last paint, in ascending order. Hit-testing and marquee selection only look at these. */
+	mutable TArray<int32> VisibleNodeIndices;
+
 	/* Contains the indices of the node that are currently selected. */
 	TArray<int32> SelectedNodeIndices;
 
@@ -978,8 +996,12 @@ void SPaperZDAnimNotifyNode::Construct(const FArguments& InArgs)
 	bBeingDragged = false;
 	CurrentDragHandle = ENotifyStateHandleHit::None;
 	bDrawTooltipToRight = true;
+	bIsInViewRange = true;
 	bSelected = false;
 	DragMarkerTransactionIdx = INDEX_NONE;
+	LabelWidth = 0.0f;
+	TextSize = FVector2D::ZeroVector;
+	MeasuredLabelName = NAME_None;
 
 	OnNodeDragStarted = InArgs._OnNodeDragStarted;
 	PanTrackRequest = InArgs._PanTrackRequest;
@@ -998,6 +1020,7 @@ void SPaperZDAnimNotifyNode::Construct(const FArguments& InArgs)
 
 	SetClipping(EWidgetClipping::ClipToBounds);
 	SetToolTipText(TAttribute<FText>(this, &SPaperZDAnimNotifyNode::GetNodeTooltip));
+	SetVisibility(TAttribute<EVisibility>(this, &SPaperZDAnimNotifyNode::GetNodeVisibility));
 }
 
 void SPaperZDAnimNotifyNode::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
@@ -1306,9 +1329,7 @@ void SPaperZDAnimNotifyNode::UpdateSizeAndPosition(const FGeometry& AllottedGeom
 	NotifyTimePositionX = ScaleInfo.InputToLocalX(GetTime());
 	NotifyDurationSizeX = ScaleInfo.PixelsPerInput * GetDuration();
 
-	const TSharedRef< FSlateFontMeasure > FontMeasureService = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-	TextSize = FontMeasureService->Measure(FText::FromName(GetNotifyName()), Font);
-	LabelWidth = TextSize.X + (TextBorderSize.X * 2.f) + (ScrubHandleSize.X / 2.f);
+	UpdateLabelSize();
 
 	//No branching points 
 // 	bool bDrawBranchingPoint = NodeObjectInterface->IsBranchingPoint();
@@ -1341,6 +1362,29 @@ void SPaperZDAnimNotifyNode::UpdateSizeAndPosition(const FGeometry& AllottedGeom
 	NotifyScrubHandleCentre = bDrawTooltipToRight ? NotifyHandleBoxWidth / 2.f : LabelWidth;
 }
 
+void SPaperZDAnimNotifyNode::UpdateLabelSize()
+{
+	//Measuring text is expensive, only do it when the label actually changes
+	const FName NotifyName = GetNotifyName();
+	if (NotifyName != MeasuredLabelName || LabelWidth <= 0.0f)
+	{
+		const TSharedRef< FSlateFontMeasure > FontMeasureService = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+		TextSize = FontMeasureService->Measure(FText::FromName(NotifyName), Font);
+		LabelWidth = TextSize.X + (TextBorderSize.X * 2.f) + (ScrubHandleSize.X / 2.f);
+		MeasuredLabelName = NotifyName;
+	}
+}
+
+bool SPaperZDAnimNotifyNode::IsInViewRange(float InViewMin, float InViewMax, float PixelsPerInput)
+{
+	//The label can be drawn to either side of the notify marker, so pad the range with its size
+	UpdateLabelSize();
+	const float PaddingPixels = LabelWidth + FMath::Max(ScrubHandleSize.X, AlignmentMarkerSize.X * 2);
+	const float PaddingTime = PixelsPerInput > 0.0f ? PaddingPixels / PixelsPerInput : 0.0f;
+	const float StartTime = GetTime();
+	return StartTime - PaddingTime <= InViewMax && StartTime + GetDuration() + PaddingTime >= InViewMin;
+}
+
 FCursorReply SPaperZDAnimNotifyNode::OnCursorQuery(const FGeometry& MyGeometry, const FPointerEvent& CursorEvent) const
 {
 	// Show resize cursor if the cursor is hovering over either of the scrub handles of a notify state node
@@ -1537,6 +1581,7 @@ void SPaperZDAnimNotifyTrack::Update()
 {
 	//Clear all the notifies and reset the track itself.
 	NotifyNodes.Empty();
+	VisibleNodeIndices.Reset();
 	TrackArea->SetContent(
 		SAssignNew(NodeOverlay, SOverlay)
 	);
@@ -1594,12 +1639,24 @@ int32 SPaperZDAnimNotifyTrack::OnPaint(const FPaintArgs& Args, const FGeometry&
 	const FPaintGeometry MyGeometry = AllottedGeometry.ToPaintGeometry();
 	int32 CustomLayerId = LayerId;
 
+	//Only the nodes inside the view range get their layout updated, the rest are collapsed and skipped by arrange, paint and hit-testing
+	const float ViewMin = ViewInputMin.Get();
+	const float ViewMax = ViewInputMax.Get();
+	const FTrackScaleInfo ScaleInfo(ViewMin, ViewMax, 0.f, 0.f, AllottedGeometry.Size);
 	bool bAnyDraggedNodes = false;
+	VisibleNodeIndices.Reset();
 	for (int32 i = 0; i < NotifyNodes.Num(); i++)
 	{
-		if (NotifyNodes[i].Get()->IsBeingDragged() == false)
+		SPaperZDAnimNotifyNode* Node = NotifyNodes[i].Get();
+		if (Node->IsBeingDragged() == false)
 		{
-			NotifyNodes[i].Get()->UpdateSizeAndPosition(AllottedGeometry);
+			const bool bInViewRange = Node->IsValid() && Node->IsInViewRange(ViewMin, ViewMax, ScaleInfo.PixelsPerInput);
+			Node->SetInViewRange(bInViewRange);
+			if (bInViewRange)
+			{
+				Node->UpdateSizeAndPosition(AllottedGeometry);
+				VisibleNodeIndices.Add(i);
+			}
 		}
 		else
 		{
@@ -1812,11 +1869,12 @@ void SPaperZDAnimNotifyTrack::HandleNodeDrop(TSharedPtr<SPaperZDAnimNotifyNode>
 
 int32 SPaperZDAnimNotifyTrack::GetHitNotifyNode(const FGeometry& MyGeometry, const FVector2D& CursorPosition)
 {
-	for (int32 I = NotifyNodes.Num() - 1; I >= 0; --I) //Run through from 'top most' Notify to bottom
+	for (int32 i = VisibleNodeIndices.Num() - 1; i >= 0; --i) //Run through from 'top most' Notify to bottom
 	{
-		if (NotifyNodes[I].Get()->HitTest(MyGeometry, CursorPosition))
+		const int32 NodeIndex = VisibleNodeIndices[i];
+		if (NotifyNodes.IsValidIndex(NodeIndex) && NotifyNodes[NodeIndex].Get()->HitTest(MyGeometry, CursorPosition))
 		{
-			return I;
+			return NodeIndex;
 		}
 	}
 
@@ -1865,8 +1923,14 @@ void SPaperZDAnimNotifyTrack::RefreshMarqueeSelectedNodes(FSlateRect& Rect, FPap
 		}
 	}
 
-	for (int32 Index = 0; Index < NotifyNodes.Num(); ++Index)
+	//Nodes outside of the view range can't be inside the marquee, and their layout is stale
+	for (int32 Index : VisibleNodeIndices)
 	{
+		if (!NotifyNodes.IsValidIndex(Index))
+		{
+			continue;
+		}
+
 		TSharedPtr<SPaperZDAnimNotifyNode> Node = NotifyNodes[Index];
 		FSlateRect NodeRect = FSlateRect(Node->GetPosition(), Node->GetPosition() + Node->GetSize());
 
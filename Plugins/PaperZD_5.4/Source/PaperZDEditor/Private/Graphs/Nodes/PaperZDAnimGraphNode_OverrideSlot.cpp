@@ -41,6 +41,24 @@ void UPaperZDAnimGraphNode_OverrideSlot::OnProcessDuringCompilation(FPaperZDAnim
 		FPaperZDOverrideSlotDescriptor NewDescriptor;
 		NewDescriptor.SlotName = AnimNode.SlotName;
 		NewDescriptor.GroupName = AnimNode.GroupName;
+		NewDescriptor.SlotIndex = SlotDescriptors.Num();
+
+		//Slots on the same group share the index, so the instances can keep a single override per group
+		NewDescriptor.GroupIndex = INDEX_NONE;
+		int32 NumGroups = 0;
+		for (const TPair<FName, FPaperZDOverrideSlotDescriptor>& SlotPair : SlotDescriptors)
+		{
+			NumGroups = FMath::Max(NumGroups, SlotPair.Value.GroupIndex + 1);
+			if (SlotPair.Value.GroupName == NewDescriptor.GroupName)
+			{
+				NewDescriptor.GroupIndex = SlotPair.Value.GroupIndex;
+			}
+		}
+
+		if (NewDescriptor.GroupIndex == INDEX_NONE)
+		{
+			NewDescriptor.GroupIndex = NumGroups;
+		}
 		
 		//Key by the slot name for easier runtime searches
 		SlotDescriptors.Add(NewDescriptor.SlotName, NewDescriptor);
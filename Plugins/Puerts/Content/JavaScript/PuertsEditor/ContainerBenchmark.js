@@ -0,0 +1,161 @@
+"use strict";
+// driven by UPuertsContainerBenchmarkCommandlet
+const UE = require("ue");
+const target = puerts.argv.getByName("Target");
+const iterations = target.Iterations;
+let mismatches = 0;
+function check(label, result, expected) {
+    if (result !== expected) {
+        if (mismatches < 8) {
+            console.error(`container check, ${label}: got ${result}, expected ${expected}`);
+        }
+        mismatches++;
+    }
+}
+function throws(fn) {
+    try {
+        fn();
+    } catch (e) {
+        return true;
+    }
+    return false;
+}
+function sumTyped(typed) {
+    let sum = 0;
+    for (let i = 0; i < typed.length; i++) {
+        sum += typed[i];
+    }
+    return sum;
+}
+for (const count of [0, 1, 10, 1000]) {
+    target.Fill(count);
+    const points = target.Points;
+    const values = target.Values;
+    let expectedPoints = 0;
+    let expectedValues = 0;
+    for (let i = 0; i < count; i++) {
+        const point = points.Get(i);
+        expectedPoints += point.X + point.Y + point.Z;
+        expectedValues += values.Get(i);
+    }
+    check(`ToTypedArray points ${count}`, sumTyped(points.ToTypedArray()), expectedPoints);
+    check(`ToTypedArray values ${count}`, sumTyped(values.ToTypedArray()), expectedValues);
+    // native code may resize its own arrays behind js' back, views are only for arrays js owns
+    check(`view of native array ${count}`, throws(() => values.GetTypedArrayView()), true);
+    const jsPoints = UE.NewArray(UE.Vector);
+    jsPoints.FromTypedArray(points.ToTypedArray());
+    const jsValues = UE.NewArray(UE.BuiltinFloat);
+    jsValues.FromTypedArray(values.ToTypedArray());
+    check(`view length ${count}`, jsPoints.GetTypedArrayView().length, count * 3);
+    check(`view ${count}`, sumTyped(jsValues.GetTypedArrayView()), expectedValues);
+    const view = jsValues.GetTypedArrayView();
+    if (count > 0) {
+        check(`view cached ${count}`, jsValues.GetTypedArrayView(), view);
+    }
+    for (let i = 0; i < view.length; i++) {
+        view[i] = i;
+    }
+    check(`view write ${count}`, target.SumOf(jsValues), count * (count - 1) / 2);
+    jsValues.Add(1);
+    check(`view detached ${count}`, view.length, 0);
+    const outView = jsValues.GetTypedArrayView();
+    target.AppendValue(puerts.$ref(jsValues), 2);
+    check(`view detached by out parameter ${count}`, outView.length, 0);
+    check(`out parameter ${count}`, jsValues.Num(), count + 2);
+    const copied = points.ToTypedArray();
+    copied.fill(1);
+    points.FromTypedArray(copied.subarray(0, copied.length - (count > 0 ? 3 : 0)));
+    check(`FromTypedArray num ${count}`, points.Num(), Math.max(count - 1, 0));
+    check(`FromTypedArray ${count}`, target.SumPoints(), Math.max(count - 1, 0) * 3);
+    // from a view of the array itself
+    jsValues.FromTypedArray(jsValues.GetTypedArrayView());
+    check(`FromTypedArray self ${count}`, jsValues.Num(), count + 2);
+    target.Fill(count);
+    let expectedIds = 0;
+    for (const id of target.Ids) {
+        expectedIds += id;
+    }
+    check(`set ToArray ${count}`, target.Ids.ToArray().reduce((a, b) => a + b, 0), expectedIds);
+    let expectedScores = 0;
+    for (const [key, score] of target.Scores) {
+        expectedScores += key + score;
+    }
+    check(`map ToArray ${count}`, target.Scores.ToArray().reduce((a, [key, score]) => a + key + score, 0), expectedScores);
+}
+target.Mismatches = mismatches;
+console.log(`container check: ${mismatches} mismatches`);
+function run(label, count, fn) {
+    const start = Date.now();
+    let result;
+    for (let i = 0; i < iterations; i++) {
+        result = fn();
+    }
+    console.log(`container benchmark, ${label}, ${count} elements: ${Date.now() - start} ms for ${iterations} rounds (${result})`);
+}
+for (const count of [10, 1000, 100000]) {
+    target.Fill(count);
+    const points = target.Points;
+    const values = target.Values;
+    const ids = target.Ids;
+    const scores = target.Scores;
+    run("read points, Get", count, () => {
+        let sum = 0;
+        for (let i = 0, num = points.Num(); i < num; i++) {
+            const point = points.Get(i);
+            sum += point.X + point.Y + point.Z;
+        }
+        return sum;
+    });
+    run("read points, ToTypedArray", count, () => sumTyped(points.ToTypedArray()));
+    const jsPoints = UE.NewArray(UE.Vector);
+    jsPoints.FromTypedArray(points.ToTypedArray());
+    run("read js points, GetTypedArrayView", count, () => sumTyped(jsPoints.GetTypedArrayView()));
+    run("read values, Get", count, () => {
+        let sum = 0;
+        for (let i = 0, num = values.Num(); i < num; i++) {
+            sum += values.Get(i);
+        }
+        return sum;
+    });
+    const source = values.ToTypedArray();
+    const jsValues = UE.NewArray(UE.BuiltinFloat);
+    jsValues.FromTypedArray(source);
+    run("read js values, GetTypedArrayView", count, () => sumTyped(jsValues.GetTypedArrayView()));
+    run("write values, Set", count, () => {
+        for (let i = 0; i < source.length; i++) {
+            values.Set(i, source[i]);
+        }
+        return values.Num();
+    });
+    run("write values, Empty and Add", count, () => {
+        values.Empty();
+        for (let i = 0; i < source.length; i++) {
+            values.Add(source[i]);
+        }
+        return values.Num();
+    });
+    run("write values, FromTypedArray", count, () => {
+        values.FromTypedArray(source);
+        return values.Num();
+    });
+    run("write js values, GetTypedArrayView", count, () => {
+        jsValues.GetTypedArrayView().set(source);
+        return jsValues.Num();
+    });
+    run("read set, iterator", count, () => {
+        let sum = 0;
+        for (const id of ids) {
+            sum += id;
+        }
+        return sum;
+    });
+    run("read set, ToArray", count, () => ids.ToArray().reduce((a, b) => a + b, 0));
+    run("read map, iterator", count, () => {
+        let sum = 0;
+        for (const [key, score] of scores) {
+            sum += key + score;
+        }
+        return sum;
+    });
+    run("read map, ToArray", count, () => scores.ToArray().reduce((a, [key, score]) => a + key + score, 0));
+}
@@ -0,0 +1,8 @@
+"use strict";
+// driven by UPuertsDelegateBenchmarkCommandlet, binds a callback to the multicast delegate of every target
+const args = puerts.argv.getByName("Args");
+const targets = args.Targets;
+let fired = 0;
+for (let i = 0; i < targets.Num(); i++) {
+    targets.Get(i).OnEvent.Add(() => { fired++; });
+}
@@ -0,0 +1,36 @@
+"use strict";
+// driven by UPuertsDispatchBenchmarkCommandlet
+const UE = require("ue");
+const puerts_1 = require("puerts");
+const target = puerts.argv.getByName("Target");
+const iterations = target.Iterations;
+class DispatchMixin {
+    Step(Value) {
+        return Value * 2 + 1;
+    }
+}
+puerts_1.blueprint.mixin(UE.PuertsDispatchBenchmarkTarget, DispatchMixin);
+let mismatches = 0;
+function check(label, result, expected) {
+    if (result !== expected) {
+        if (mismatches < 8) {
+            console.error(`dispatch check, ${label}: got ${result}, expected ${expected}`);
+        }
+        mismatches++;
+    }
+}
+for (let i = 0; i < 1000; i++) {
+    check("Step", target.Step(i), i * 2 + 1);
+}
+check("RunFrame", target.RunFrame(1000), 1000n * 1000n);
+target.Mismatches = mismatches;
+console.log(`dispatch check: ${mismatches} mismatches`);
+const frames = 10;
+const start = Date.now();
+let sum = 0n;
+for (let i = 0; i < frames; i++) {
+    sum += target.RunFrame(iterations);
+}
+check("RunFrame from js", sum, BigInt(frames) * BigInt(iterations) * BigInt(iterations));
+target.Mismatches = mismatches;
+console.log(`dispatch benchmark, from js: ${(Date.now() - start) / frames} ms per frame of ${iterations} calls (${sum})`);
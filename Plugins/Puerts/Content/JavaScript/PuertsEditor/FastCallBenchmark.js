@@ -0,0 +1,75 @@
+"use strict";
+// driven by UPuertsFastCallBenchmarkCommandlet
+const target = puerts.argv.getByName("Target");
+const iterations = target.Iterations;
+// enough calls for turbofan to optimize the loops, the first ones run in the interpreter and take the regular callback
+const checkIterations = 200000;
+let mismatches = 0;
+function check(label, call, expected) {
+    let failed = 0;
+    for (let i = 0; i < checkIterations; i++) {
+        const result = call(i);
+        const want = expected(i);
+        if (result !== want) {
+            if (failed < 4) {
+                console.error(`fast call check, ${label}: got ${result}, expected ${want} at ${i}`);
+            }
+            failed++;
+        }
+    }
+    mismatches += failed;
+}
+check("GetHealth", (i) => target.GetHealth(), (i) => 100);
+check("GetAmmo", (i) => target.GetAmmo(), (i) => 30);
+check("IsAlive", (i) => target.IsAlive(), (i) => true);
+check("AddInts", (i) => target.AddInts(i * 65537 | 0, 0x7ffffff0), (i) => ((i * 65537 | 0) + 0x7ffffff0) | 0);
+check("ScaleValue", (i) => target.ScaleValue(i * 0.37, 1.5), (i) => Math.fround(i * 0.37) * 1.5);
+check("ToByte", (i) => target.ToByte(i * 31), (i) => (i * 31) & 255);
+check("Select", (i) => target.Select((i & 1) === 1, i, -i), (i) => ((i & 1) === 1 ? i : -i));
+check("NextState", (i) => target.NextState(i % 3), (i) => (i % 3 + 1) % 3);
+check("IsSameObject", (i) => target.IsSameObject((i & 1) === 1 ? target : null), (i) => (i & 1) === 1);
+target.Mismatches = mismatches;
+console.log(`fast call check: ${mismatches} mismatches`);
+function run(label, fn) {
+    const start = Date.now();
+    const result = fn();
+    console.log(`fast call benchmark, ${label}: ${Date.now() - start} ms for ${iterations} calls (${result})`);
+}
+run("GetHealth", () => {
+    let sum = 0;
+    for (let i = 0; i < iterations; i++) {
+        sum += target.GetHealth();
+    }
+    return sum;
+});
+run("GetAmmo", () => {
+    let sum = 0;
+    for (let i = 0; i < iterations; i++) {
+        sum += target.GetAmmo();
+    }
+    return sum;
+});
+run("IsAlive", () => {
+    let count = 0;
+    for (let i = 0; i < iterations; i++) {
+        if (target.IsAlive()) {
+            count++;
+        }
+    }
+    return count;
+});
+run("AddInts", () => {
+    let acc = 0;
+    for (let i = 0; i < iterations; i++) {
+        acc = target.AddInts(acc, i);
+    }
+    return acc;
+});
+// struct return, always on the regular callback
+run("GetLocation", () => {
+    let sum = 0;
+    for (let i = 0; i < iterations; i++) {
+        sum += target.GetLocation().X;
+    }
+    return sum;
+});
@@ -0,0 +1,83 @@
+"use strict";
+// driven by UPuertsFrameBenchmarkCommandlet
+const UE = require("ue");
+const puerts_1 = require("puerts");
+const target = puerts.argv.getByName("Target");
+const iterations = target.Iterations;
+const offset = new UE.Vector(1, 2, 3);
+const values = UE.NewArray(UE.BuiltinInt);
+values.Add(1);
+values.Add(2);
+values.Add(3);
+const name = "Frame";
+let mismatches = 0;
+function check(label, result, expected) {
+    if (result !== expected) {
+        if (mismatches < 8) {
+            console.error(`frame check, ${label}: got ${result}, expected ${expected}`);
+        }
+        mismatches++;
+    }
+}
+for (let i = 0; i < 1000; i++) {
+    target.Counter = 0;
+    target.Tick();
+    check("Tick", target.Counter, 1);
+    check("Mix3", target.Mix3(i, 2, (i & 1) === 1), (i & 1) === 1 ? i + 2 : i - 2);
+    check("Describe3", target.Describe3(name, i, offset), `${name}:${i}:6`);
+    check("Sum8", target.Sum8(i, 1, 0.5, 1.5, 2.25, 3.75, true, -i), 10);
+    check("Mix8", target.Mix8(i, 2, name, offset, false, values, "Bench", 0.5), i + 2 + 5 + 6 + 5 + 0.5 + 6);
+    const total = (0, puerts_1.$ref)(i);
+    target.Accumulate8(1, 2, name, offset, true, values, "Bench", total);
+    check("Accumulate8", (0, puerts_1.$unref)(total), i + 1 + 2 + 5 + 1 + 1 + 3 + 5);
+}
+target.Mismatches = mismatches;
+console.log(`frame check: ${mismatches} mismatches`);
+function run(label, fn) {
+    const start = Date.now();
+    const result = fn();
+    console.log(`frame benchmark, ${label}: ${Date.now() - start} ms for ${iterations} calls (${result})`);
+}
+run("0 params", () => {
+    target.Counter = 0;
+    for (let i = 0; i < iterations; i++) {
+        target.Tick();
+    }
+    return target.Counter;
+});
+run("3 params, scalar", () => {
+    let acc = 0;
+    for (let i = 0; i < iterations; i++) {
+        acc = target.Mix3(acc & 0xffff, 1, (i & 1) === 1);
+    }
+    return acc;
+});
+run("3 params, mixed", () => {
+    let length = 0;
+    for (let i = 0; i < iterations; i++) {
+        length += target.Describe3(name, i & 0xff, offset).length;
+    }
+    return length;
+});
+run("8 params, scalar", () => {
+    let sum = 0;
+    for (let i = 0; i < iterations; i++) {
+        sum += target.Sum8(i, 1, 0.5, 1.5, 2.25, 3.75, true, -i);
+    }
+    return sum;
+});
+run("8 params, mixed", () => {
+    let sum = 0;
+    for (let i = 0; i < iterations; i++) {
+        sum += target.Mix8(i & 0xff, 2, name, offset, false, values, "Bench", 0.5);
+    }
+    return sum;
+});
+run("8 params, mixed with out", () => {
+    const total = (0, puerts_1.$ref)(0);
+    for (let i = 0; i < iterations; i++) {
+        (0, puerts_1.$set)(total, 0);
+        target.Accumulate8(1, 2, name, offset, true, values, "Bench", total);
+    }
+    return (0, puerts_1.$unref)(total);
+});
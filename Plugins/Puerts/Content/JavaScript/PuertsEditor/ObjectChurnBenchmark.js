@@ -0,0 +1,11 @@
+"use strict";
+// driven by UPuertsObjectChurnBenchmarkCommandlet, keeps a wrapper alive for every actor of the last spawned batch
+const bridge = puerts.argv.getByName("Bridge");
+let lastBatch = [];
+bridge.OnActorsSpawned.Add((actors) => {
+    const batch = [];
+    for (let i = 0; i < actors.Num(); i++) {
+        batch.push(actors.Get(i));
+    }
+    lastBatch = batch;
+});
@@ -0,0 +1,67 @@
+"use strict";
+// driven by UPuertsStringBenchmarkCommandlet
+const target = puerts.argv.getByName("Target");
+const iterations = target.Iterations;
+function run(label, fn) {
+    const start = Date.now();
+    fn();
+    console.log(`string benchmark, ${label}: ${Date.now() - start} ms for ${iterations} calls`);
+}
+function makeNames(count, prefix) {
+    const names = [];
+    for (let i = 0; i < count; i++) {
+        names.push(prefix + i);
+    }
+    return names;
+}
+// typical: a few dozen state names passed over and over
+const fewNames = makeNames(32, "State_");
+run("32 names js -> ue", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.SetNameValue(fewNames[i & 31]);
+    }
+});
+run("name ue -> js", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.GetNameValue();
+    }
+});
+const shortString = "damage_number_123";
+target.SetStringValue(shortString);
+run("short ascii string js -> ue", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.SetStringValue(shortString);
+    }
+});
+run("short ascii string ue -> js", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.GetStringValue();
+    }
+});
+// worst case: more distinct names than the cache holds, built at runtime so they are not internalized
+const manyNames = makeNames(16384, "Dynamic_");
+run("16384 distinct names js -> ue", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.SetNameValue(manyNames[i & 16383]);
+    }
+});
+const longString = "x".repeat(4096);
+const longIterations = Math.max(1, iterations >> 4);
+target.SetStringValue(longString);
+run("4k ascii string ue -> js (1/16 of the calls)", () => {
+    for (let i = 0; i < longIterations; i++) {
+        target.GetStringValue();
+    }
+});
+const wideString = "伤害数值".repeat(16);
+target.SetStringValue(wideString);
+run("non latin-1 string ue -> js", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.GetStringValue();
+    }
+});
+run("non latin-1 string js -> ue", () => {
+    for (let i = 0; i < iterations; i++) {
+        target.SetStringValue(wideString);
+    }
+});
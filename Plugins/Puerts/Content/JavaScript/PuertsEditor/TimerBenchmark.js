@@ -0,0 +1,24 @@
+"use strict";
+// driven by UPuertsTimerBenchmarkCommandlet, half the timers re-arm themselves like short lived ui effects, the other half are intervals
+const args = puerts.argv.getByName("Args");
+const numTimers = args.NumTimers;
+// fixed seed, so every run schedules the same delays
+let seed = 12345;
+function nextDelay(max) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % max;
+}
+let fired = 0;
+function rearm() {
+    fired++;
+    setTimeout(rearm, nextDelay(500));
+}
+for (let i = 0; i < numTimers; i++) {
+    if (i % 2 == 0) {
+        setTimeout(rearm, nextDelay(500));
+    }
+    else {
+        setInterval(() => { fired++; }, 16 + nextDelay(1000));
+    }
+}
+setInterval(() => { args.NumFired = fired; }, 0);
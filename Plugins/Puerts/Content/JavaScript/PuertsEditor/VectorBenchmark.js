@@ -0,0 +1,48 @@
+"use strict";
+// driven by UPuertsVectorBenchmarkCommandlet
+const UE = require("ue");
+const args = puerts.argv.getByName("Args");
+const iterations = args.Iterations;
+function run(label, fn) {
+    const start = Date.now();
+    const result = fn();
+    console.log(`vector benchmark, ${label}: ${Date.now() - start} ms for ${iterations} ops (${result})`);
+}
+run("vector add/scale", () => {
+    let v = new UE.Vector(0, 0, 0);
+    const step = new UE.Vector(1, 2, 3);
+    for (let i = 0; i < iterations; i++) {
+        v = v.op_Addition(step).op_Multiply(0.5);
+    }
+    return `${v.X},${v.Y},${v.Z}`;
+});
+run("rotator add/rotate vector", () => {
+    let r = new UE.Rotator(0, 0, 0);
+    const step = new UE.Rotator(0.1, 0.2, 0.3);
+    const forward = new UE.Vector(1, 0, 0);
+    let v = forward;
+    for (let i = 0; i < iterations; i++) {
+        r = r.op_Addition(step);
+        v = r.RotateVector(forward);
+    }
+    return `${v.X},${v.Y},${v.Z}`;
+});
+run("transform compose/transform position", () => {
+    const t = new UE.Transform(new UE.Rotator(0, 1, 0), new UE.Vector(1, 0, 0), new UE.Vector(1, 1, 1));
+    let acc = new UE.Transform(new UE.Rotator(0, 0, 0), new UE.Vector(0, 0, 0), new UE.Vector(1, 1, 1));
+    let v = new UE.Vector(0, 0, 0);
+    for (let i = 0; i < iterations; i++) {
+        acc = acc.op_Multiply(t);
+        v = acc.TransformPosition(v);
+    }
+    return `${v.X},${v.Y},${v.Z}`;
+});
+// the reflection path, struct return values copied out by the property translator
+run("KismetMathLibrary.Add_VectorVector", () => {
+    let v = new UE.Vector(0, 0, 0);
+    const step = new UE.Vector(1, 2, 3);
+    for (let i = 0; i < iterations; i++) {
+        v = UE.KismetMathLibrary.Add_VectorVector(v, step);
+    }
+    return `${v.X},${v.Y},${v.Z}`;
+});
@@ -54,11 +54,17 @@ public class JsEnv : ModuleRules
     public bool WithByteCode = false;
 
     private bool WithWebsocket = false;
+
+    // turbofan calls scalar-only functions directly, only validated with v8 10.6 on linux x64 so far
+    private bool WithV8FastCall = true;
     
     public JsEnv(ReadOnlyTargetRules Target) : base(Target)
     {
         PublicDefinitions.Add("USING_IN_UNREAL_ENGINE");
-        //PublicDefinitions.Add("WITH_V8_FAST_CALL");
+        if (WithV8FastCall && !UseNodejs && !UseQuickjs && UseV8Version == SupportedV8Versions.V10_6_194 && IsLinuxX64(Target))
+        {
+            PublicDefinitions.Add("WITH_V8_FAST_CALL");
+        }
         
         PublicDefinitions.Add("TS_BLUEPRINT_PATH=\"/Blueprints/TypeScript/\"");
         
@@ -178,6 +184,19 @@ public class JsEnv : ModuleRules
 
     }
 
+    bool IsLinuxX64(ReadOnlyTargetRules Target)
+    {
+        if (Target.Platform != UnrealTargetPlatform.Linux)
+        {
+            return false;
+        }
+#if UE_5_2_OR_LATER
+        return Target.Architecture == UnrealArch.X64;
+#else
+        return Target.Architecture.StartsWith("x86_64");
+#endif
+    }
+
     void OldThirdParty(ReadOnlyTargetRules Target)
     {
         string LibraryPath = Path.GetFullPath(Path.Combine(ModuleDirectory, "..", "..", "ThirdParty", "v8_for_ue424_or_below", "Lib"));
@@ -11,11 +11,188 @@
 
 namespace PUERTS_NAMESPACE
 {
+// typed array an element of a TArray can be copied to or viewed as
+enum class ETypedArrayKind : uint8
+{
+    None,
+    Int8,
+    Uint8,
+    Int16,
+    Uint16,
+    Int32,
+    Uint32,
+    BigInt64,
+    BigUint64,
+    Float32,
+    Float64
+};
+
+static ETypedArrayKind GetScalarTypedArrayKind(PropertyMacro* Property)
+{
+    if (const EnumPropertyMacro* EnumProperty = CastFieldMacro<EnumPropertyMacro>(Property))
+    {
+        Property = EnumProperty->GetUnderlyingProperty();
+    }
+
+    if (Property->IsA<Int8PropertyMacro>())
+    {
+        return ETypedArrayKind::Int8;
+    }
+    else if (Property->IsA<BytePropertyMacro>())
+    {
+        return ETypedArrayKind::Uint8;
+    }
+    else if (Property->IsA<Int16PropertyMacro>())
+    {
+        return ETypedArrayKind::Int16;
+    }
+    else if (Property->IsA<UInt16PropertyMacro>())
+    {
+        return ETypedArrayKind::Uint16;
+    }
+    else if (Property->IsA<IntPropertyMacro>())
+    {
+        return ETypedArrayKind::Int32;
+    }
+    else if (Property->IsA<UInt32PropertyMacro>())
+    {
+        return ETypedArrayKind::Uint32;
+    }
+    else if (Property->IsA<Int64PropertyMacro>())
+    {
+        return ETypedArrayKind::BigInt64;
+    }
+    else if (Property->IsA<UInt64PropertyMacro>())
+    {
+        return ETypedArrayKind::BigUint64;
+    }
+    else if (Property->IsA<FloatPropertyMacro>())
+    {
+        return ETypedArrayKind::Float32;
+    }
+    else if (Property->IsA<DoublePropertyMacro>())
+    {
+        return ETypedArrayKind::Float64;
+    }
+    return ETypedArrayKind::None;
+}
+
+static int32 GetTypedArrayComponentSize(ETypedArrayKind Kind)
+{
+    switch (Kind)
+    {
+        case ETypedArrayKind::Int8:
+        case ETypedArrayKind::Uint8:
+            return 1;
+        case ETypedArrayKind::Int16:
+        case ETypedArrayKind::Uint16:
+            return 2;
+        case ETypedArrayKind::Int32:
+        case ETypedArrayKind::Uint32:
+        case ETypedArrayKind::Float32:
+            return 4;
+        case ETypedArrayKind::BigInt64:
+        case ETypedArrayKind::BigUint64:
+        case ETypedArrayKind::Float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// number of typed array components one element takes: 1 for a number, the flattened members for a POD struct made only of
+// numbers of the same type without padding (FVector, FIntPoint, FLinearColor...). 0 if it can't be copied as a whole
+static int32 GetTypedArrayComponents(PropertyMacro* Property, ETypedArrayKind& InOutKind)
+{
+    if (const StructPropertyMacro* StructProperty = CastFieldMacro<StructPropertyMacro>(Property))
+    {
+        if (!(StructProperty->Struct->StructFlags & STRUCT_IsPlainOldData))
+        {
+            return 0;
+        }
+        int32 Components = 0;
+        for (TFieldIterator<PropertyMacro> It(StructProperty->Struct); It; ++It)
+        {
+            const int32 MemberComponents = GetTypedArrayComponents(*It, InOutKind);
+            if (MemberComponents == 0)
+            {
+                return 0;
+            }
+            Components += MemberComponents * It->ArrayDim;
+        }
+        return Components * GetTypedArrayComponentSize(InOutKind) == StructProperty->Struct->GetStructureSize() ? Components : 0;
+    }
+
+    const ETypedArrayKind Kind = GetScalarTypedArrayKind(Property);
+    if (Kind == ETypedArrayKind::None || (InOutKind != ETypedArrayKind::None && InOutKind != Kind))
+    {
+        return 0;
+    }
+    InOutKind = Kind;
+    return 1;
+}
+
+static v8::Local<v8::TypedArray> NewTypedArray(ETypedArrayKind Kind, v8::Local<v8::ArrayBuffer> Buffer, size_t Length)
+{
+    switch (Kind)
+    {
+        case ETypedArrayKind::Int8:
+            return v8::Int8Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Uint8:
+            return v8::Uint8Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Int16:
+            return v8::Int16Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Uint16:
+            return v8::Uint16Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Int32:
+            return v8::Int32Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Uint32:
+            return v8::Uint32Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::BigInt64:
+            return v8::BigInt64Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::BigUint64:
+            return v8::BigUint64Array::New(Buffer, 0, Length);
+        case ETypedArrayKind::Float32:
+            return v8::Float32Array::New(Buffer, 0, Length);
+        default:
+            return v8::Float64Array::New(Buffer, 0, Length);
+    }
+}
+
+static bool IsTypedArrayOf(v8::Local<v8::Value> Value, ETypedArrayKind Kind)
+{
+    switch (Kind)
+    {
+        case ETypedArrayKind::Int8:
+            return Value->IsInt8Array();
+        case ETypedArrayKind::Uint8:
+            return Value->IsUint8Array();
+        case ETypedArrayKind::Int16:
+            return Value->IsInt16Array();
+        case ETypedArrayKind::Uint16:
+            return Value->IsUint16Array();
+        case ETypedArrayKind::Int32:
+            return Value->IsInt32Array();
+        case ETypedArrayKind::Uint32:
+            return Value->IsUint32Array();
+        case ETypedArrayKind::BigInt64:
+            return Value->IsBigInt64Array();
+        case ETypedArrayKind::BigUint64:
+            return Value->IsBigUint64Array();
+        case ETypedArrayKind::Float32:
+            return Value->IsFloat32Array();
+        case ETypedArrayKind::Float64:
+            return Value->IsFloat64Array();
+        default:
+            return false;
+    }
+}
+
 v8::Local<v8::FunctionTemplate> FScriptArrayWrapper::ToFunctionTemplate(v8::Isolate* Isolate)
 {
     v8::Isolate::Scope Isolatescope(Isolate);
     auto Result = v8::FunctionTemplate::New(Isolate, New);
-    Result->InstanceTemplate()->SetInternalFieldCount(4);    // 0 Ptr, 1 Property
+    Result->InstanceTemplate()->SetInternalFieldCount(6);    // 0 Ptr, 1 Property, 4 OwnedByJs, 5 TypedArrayView
 
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Num"), v8::FunctionTemplate::New(Isolate, Num));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Add"), v8::FunctionTemplate::New(Isolate, Add));
@@ -28,6 +205,12 @@ v8::Local<v8::FunctionTemplate> FScriptArrayWrapper::ToFunctionTemplate(v8::Isol
     Result->PrototypeTemplate()->Set(
         FV8Utils::InternalString(Isolate, "IsValidIndex"), v8::FunctionTemplate::New(Isolate, IsValidIndex));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Empty"), v8::FunctionTemplate::New(Isolate, Empty));
+    Result->PrototypeTemplate()->Set(
+        FV8Utils::InternalString(Isolate, "ToTypedArray"), v8::FunctionTemplate::New(Isolate, ToTypedArray));
+    Result->PrototypeTemplate()->Set(
+        FV8Utils::InternalString(Isolate, "FromTypedArray"), v8::FunctionTemplate::New(Isolate, FromTypedArray));
+    Result->PrototypeTemplate()->Set(
+        FV8Utils::InternalString(Isolate, "GetTypedArrayView"), v8::FunctionTemplate::New(Isolate, GetTypedArrayView));
 
     return Result;
 }
@@ -48,6 +231,7 @@ void FScriptArrayWrapper::Add(const v8::FunctionCallbackInfo<v8::Value>& Info)
             return;
         }
 
+        InvalidateTypedArrayView(Isolate, Context, Info.Holder());
         int32 Index = AddUninitialized(Self, GetSizeWithAlignment(Inner->Property), Info.Length());
         for (int i = 0; i < Info.Length(); ++i)
         {
@@ -165,6 +349,7 @@ void FScriptArrayWrapper::RemoveAt(const v8::FunctionCallbackInfo<v8::Value>& In
     }
     else
     {
+        InvalidateTypedArrayView(Isolate, Context, Info.Holder());
         FScriptArrayEx::Destruct(Self, Inner->Property, Index, 1);
 #if ENGINE_MAJOR_VERSION > 4
         Self->Remove(Index, 1, GetSizeWithAlignment(Inner->Property), __STDCPP_DEFAULT_NEW_ALIGNMENT__);
@@ -201,9 +386,187 @@ void FScriptArrayWrapper::Empty(const v8::FunctionCallbackInfo<v8::Value>& Info)
         return;
     }
 
+    InvalidateTypedArrayView(Isolate, Context, Info.Holder());
     FScriptArrayEx::Empty(Self, Inner->Property);
 }
 
+void FScriptArrayWrapper::ToTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    if (!Inner->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "item info is invalid!");
+        return;
+    }
+
+    ETypedArrayKind Kind = ETypedArrayKind::None;
+    const int32 Components = GetTypedArrayComponents(Inner->Property, Kind);
+    if (Components == 0)
+    {
+        FV8Utils::ThrowException(Isolate, "element type can not be copied as a typed array");
+        return;
+    }
+
+    const size_t ByteLength = static_cast<size_t>(Self->Num()) * GetSizeWithAlignment(Inner->Property);
+    v8::Local<v8::ArrayBuffer> Ab = v8::ArrayBuffer::New(Isolate, ByteLength);
+    if (ByteLength > 0)
+    {
+        FMemory::Memcpy(DataTransfer::GetArrayBufferData(Ab), Self->GetData(), ByteLength);
+    }
+    Info.GetReturnValue().Set(NewTypedArray(Kind, Ab, static_cast<size_t>(Self->Num()) * Components));
+}
+
+void FScriptArrayWrapper::FromTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    CHECK_V8_ARGS_LEN(1);
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    if (!Inner->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "item info is invalid!");
+        return;
+    }
+
+    ETypedArrayKind Kind = ETypedArrayKind::None;
+    const int32 Components = GetTypedArrayComponents(Inner->Property, Kind);
+    if (Components == 0)
+    {
+        FV8Utils::ThrowException(Isolate, "element type can not be copied as a typed array");
+        return;
+    }
+    if (!IsTypedArrayOf(Info[0], Kind))
+    {
+        FV8Utils::ThrowException(Isolate, "typed array type does not match the element type");
+        return;
+    }
+
+    v8::Local<v8::TypedArray> Source = Info[0].As<v8::TypedArray>();
+    const size_t Length = Source->Length();
+    if (Length % Components != 0)
+    {
+        FV8Utils::ThrowException(Isolate, "typed array length is not a multiple of the element size");
+        return;
+    }
+
+    const int32 ElementSize = GetSizeWithAlignment(Inner->Property);
+    const int32 Num = Self->Num();
+    const int32 NewNum = static_cast<int32>(Length / Components);
+    const size_t ByteLength = static_cast<size_t>(NewNum) * ElementSize;
+    const uint8* Src = nullptr;
+    TArray<uint8> Temp;
+    if (ByteLength > 0)
+    {
+        Src = static_cast<const uint8*>(DataTransfer::GetArrayBufferData(Source->Buffer())) + Source->ByteOffset();
+        // a view of this very array would be freed by the resize
+        const uint8* Data = static_cast<const uint8*>(Self->GetData());
+        if (Src < Data + static_cast<size_t>(Num) * ElementSize && Src + ByteLength > Data)
+        {
+            Temp.Append(Src, ByteLength);
+            Src = Temp.GetData();
+        }
+    }
+
+    // elements are plain data, no construction or destruction needed
+    InvalidateTypedArrayView(Isolate, Context, Info.Holder());
+    if (NewNum > Num)
+    {
+        AddUninitialized(Self, ElementSize, NewNum - Num);
+    }
+    else if (NewNum < Num)
+    {
+#if ENGINE_MAJOR_VERSION > 4
+        Self->Remove(NewNum, Num - NewNum, ElementSize, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+#else
+        Self->Remove(NewNum, Num - NewNum, ElementSize);
+#endif
+    }
+    if (ByteLength > 0)
+    {
+        FMemory::Memcpy(Self->GetData(), Src, ByteLength);
+    }
+}
+
+void FScriptArrayWrapper::GetTypedArrayView(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+#if defined(WITH_QUICKJS)
+    FV8Utils::ThrowException(Isolate, "typed array views are not supported with quickjs");
+#else
+    v8::Local<v8::Object> Holder = Info.Holder();
+    // native code can resize or free any other array behind js' back, and a js view can't be told
+    if (!Holder->GetInternalField(OwnedByJsField).As<v8::Value>()->IsTrue())
+    {
+        FV8Utils::ThrowException(Isolate, "typed array views are only available for arrays created by js, use ToTypedArray");
+        return;
+    }
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Holder, 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Holder, 1);
+    if (!Inner->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "item info is invalid!");
+        return;
+    }
+
+    ETypedArrayKind Kind = ETypedArrayKind::None;
+    const int32 Components = GetTypedArrayComponents(Inner->Property, Kind);
+    if (Components == 0)
+    {
+        FV8Utils::ThrowException(Isolate, "element type can not be viewed as a typed array");
+        return;
+    }
+
+    void* Data = Self->GetData();
+    const size_t ByteLength = static_cast<size_t>(Self->Num()) * GetSizeWithAlignment(Inner->Property);
+    v8::Local<v8::Value> Cached = Holder->GetInternalField(TypedArrayViewField).As<v8::Value>();
+    if (Cached->IsTypedArray())
+    {
+        v8::Local<v8::TypedArray> View = Cached.As<v8::TypedArray>();
+        size_t ViewByteLength;
+        void* ViewData = DataTransfer::GetArrayBufferData(View->Buffer(), ViewByteLength);
+        if (ViewData == Data && ViewByteLength == ByteLength)
+        {
+            Info.GetReturnValue().Set(View);
+            return;
+        }
+        InvalidateTypedArrayView(Isolate, Context, Holder);
+    }
+
+    if (ByteLength == 0)
+    {
+        Info.GetReturnValue().Set(NewTypedArray(Kind, v8::ArrayBuffer::New(Isolate, 0), 0));
+        return;
+    }
+
+    v8::Local<v8::TypedArray> View = NewTypedArray(
+        Kind, DataTransfer::NewArrayBuffer(Context, Data, ByteLength), static_cast<size_t>(Self->Num()) * Components);
+    Holder->SetInternalField(TypedArrayViewField, View);
+    // keeps the wrapper, and so the array, alive as long as the view
+    __USE(View->SetPrivate(Context, v8::Private::ForApi(Isolate, FV8Utils::InternalString(Isolate, "puerts:ViewOwner")), Holder));
+    Info.GetReturnValue().Set(View);
+#endif
+}
+
+void FScriptArrayWrapper::MarkOwnedByJs(v8::Isolate* Isolate, v8::Local<v8::Object> Holder)
+{
+#if !defined(WITH_QUICKJS)
+    Holder->SetInternalField(OwnedByJsField, v8::True(Isolate));
+#endif
+}
+
 FORCEINLINE int32 FScriptArrayWrapper::AddUninitialized(FScriptArray* ScriptArray, int32 ElementSize, int32 Count)
 {
 #if ENGINE_MAJOR_VERSION > 4
@@ -283,6 +646,7 @@ v8::Local<v8::FunctionTemplate> FScriptSetWrapper::ToFunctionTemplate(v8::Isolat
     Result->PrototypeTemplate()->Set(
         FV8Utils::InternalString(Isolate, "IsValidIndex"), v8::FunctionTemplate::New(Isolate, IsValidIndex));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Empty"), v8::FunctionTemplate::New(Isolate, Empty));
+    Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "ToArray"), v8::FunctionTemplate::New(Isolate, ToArray));
 
     return Result;
 }
@@ -453,6 +817,34 @@ void FScriptSetWrapper::Empty(const v8::FunctionCallbackInfo<v8::Value>& Info)
     FScriptSetEx::Empty(Self, Inner->Property);
 }
 
+void FScriptSetWrapper::ToArray(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    auto Self = FV8Utils::GetPointerFast<FScriptSet>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    if (!Inner->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "item info is invalid!");
+        return;
+    }
+    auto Property = Inner->Property;
+
+    auto ScriptLayout = FScriptSet::GetScriptLayout(Property->GetSize(), Property->GetMinAlignment());
+    TArray<v8::Local<v8::Value>> Elements;
+    Elements.Reserve(Self->Num());
+    for (int32 i = 0, MaxIndex = Self->GetMaxIndex(); i < MaxIndex; ++i)
+    {
+        if (Self->IsValidIndex(i))
+        {
+            Elements.Add(Inner->UEToJs(Isolate, Context, Self->GetData(i, ScriptLayout), false));
+        }
+    }
+    Info.GetReturnValue().Set(v8::Array::New(Isolate, Elements.GetData(), Elements.Num()));
+}
+
 int32 FScriptSetWrapper::FindIndexInner(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
     v8::Isolate* Isolate = Info.GetIsolate();
@@ -501,6 +893,7 @@ v8::Local<v8::FunctionTemplate> FScriptMapWrapper::ToFunctionTemplate(v8::Isolat
         FV8Utils::InternalString(Isolate, "IsValidIndex"), v8::FunctionTemplate::New(Isolate, IsValidIndex));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "GetKey"), v8::FunctionTemplate::New(Isolate, GetKey));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Empty"), v8::FunctionTemplate::New(Isolate, Empty));
+    Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "ToArray"), v8::FunctionTemplate::New(Isolate, ToArray));
 
     return Result;
 }
@@ -730,6 +1123,40 @@ void FScriptMapWrapper::Empty(const v8::FunctionCallbackInfo<v8::Value>& Info)
     FScriptMapEx::Empty(Self, KeyProperty, ValueProperty);
 }
 
+void FScriptMapWrapper::ToArray(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    auto Self = FV8Utils::GetPointerFast<FScriptMap>(Info.Holder(), 0);
+    auto KeyPropertyTranslator = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    auto KeyProperty = KeyPropertyTranslator->Property;
+    auto ValuePropertyTranslator = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 2);
+    auto ValueProperty = ValuePropertyTranslator->Property;
+    if (!KeyPropertyTranslator->IsPropertyValid() || !ValuePropertyTranslator->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "key/value info is invalid!");
+        return;
+    }
+
+    auto ScriptLayout = GetScriptLayout(KeyProperty, ValueProperty);
+    TArray<v8::Local<v8::Value>> Pairs;
+    Pairs.Reserve(Self->Num());
+    for (int32 i = 0, MaxIndex = Self->GetMaxIndex(); i < MaxIndex; ++i)
+    {
+        if (Self->IsValidIndex(i))
+        {
+            uint8* Data = reinterpret_cast<uint8*>(Self->GetData(i, ScriptLayout));
+            v8::Local<v8::Value> Pair[2] = {
+                KeyPropertyTranslator->UEToJs(Isolate, Context, Data + GetKeyOffset(ScriptLayout), false),
+                ValuePropertyTranslator->UEToJs(Isolate, Context, Data + ScriptLayout.ValueOffset, false)};
+            Pairs.Add(v8::Array::New(Isolate, Pair, 2));
+        }
+    }
+    Info.GetReturnValue().Set(v8::Array::New(Isolate, Pairs.GetData(), Pairs.Num()));
+}
+
 FScriptMapLayout FScriptMapWrapper::GetScriptLayout(const PropertyMacro* KeyProperty, const PropertyMacro* ValueProperty)
 {
     return FScriptMap::GetScriptLayout(
@@ -279,6 +279,27 @@ class FScriptArrayWrapper : public FContainerWrapper<FScriptArray>
 public:
     static v8::Local<v8::FunctionTemplate> ToFunctionTemplate(v8::Isolate* Isolate);
 
+    // the array memory belongs to the wrapper (created by js or copied for it), only those can be viewed as a typed array
+    static void MarkOwnedByJs(v8::Isolate* Isolate, v8::Local<v8::Object> Holder);
+
+    // detaches the view returned by GetTypedArrayView if any, to be called before the array may be resized or freed
+    FORCEINLINE static void InvalidateTypedArrayView(
+        v8::Isolate* Isolate, v8::Local<v8::Context>& Context, v8::Local<v8::Object> Holder)
+    {
+#if !defined(WITH_QUICKJS)
+        v8::Local<v8::Value> Cached = Holder->GetInternalField(TypedArrayViewField).As<v8::Value>();
+        if (Cached->IsTypedArray())
+        {
+            v8::Local<v8::ArrayBuffer> Buffer = Cached.As<v8::TypedArray>()->Buffer();
+            if (Buffer->IsDetachable())
+            {
+                Buffer->Detach();
+            }
+            Holder->SetInternalField(TypedArrayViewField, v8::Undefined(Isolate));
+        }
+#endif
+    }
+
 private:
     // 参数：一到多个容器元素
     // 返回：无
@@ -325,6 +346,26 @@ private:
     // 作用：清空容器
     static void Empty(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    // 参数：无
+    // 返回：TypedArray（值类型，有内存拷贝）
+    // 作用：一次拷贝出全部元素，元素需是数值，或只由同一种数值成员组成的POD结构体（如FVector、FIntPoint，按成员展开），否则抛出异常
+    static void ToTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    // 参数：TypedArray，类型需和ToTypedArray返回的一致
+    // 返回：无
+    // 作用：一次拷贝替换容器的全部元素，长度需是每个元素成员数的整数倍，否则抛出异常
+    static void FromTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    // 参数：无
+    // 返回：TypedArray（引用类型，无内存拷贝，直接指向容器的内存）
+    // 作用：元素要求同ToTypedArray，且容器需由js创建（或是拷贝给js的），UObject成员等原生持有的容器会抛出异常，应使用ToTypedArray。
+    // 通过容器接口增删元素，或作为非const引用参数传给原生函数后，之前返回的TypedArray会被detach（长度变为0），所以每次使用前都应重新获取
+    static void GetTypedArrayView(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    static constexpr int OwnedByJsField = 4;
+
+    static constexpr int TypedArrayViewField = 5;
+
     FORCEINLINE static int32 AddUninitialized(FScriptArray* ScriptArray, int32 ElementSize, int32 Count = 1);
 
     FORCEINLINE static uint8* GetData(FScriptArray* ScriptArray, int32 ElementSize, int32 Index);
@@ -360,6 +401,9 @@ private:
 
     static void Empty(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    // all elements as a js array (value types, copied) in one call
+    static void ToArray(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
     FORCEINLINE static int32 FindIndexInner(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     FORCEINLINE static void InternalGet(const v8::FunctionCallbackInfo<v8::Value>& Info, bool PassByPointer);
@@ -389,6 +433,9 @@ private:
 
     static void Empty(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    // all pairs as a js array of [key, value] (value types, copied) in one call
+    static void ToArray(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
     FORCEINLINE static FScriptMapLayout GetScriptLayout(const PropertyMacro* KeyProperty, const PropertyMacro* ValueProperty);
 
     FORCEINLINE static void InternalGet(const v8::FunctionCallbackInfo<v8::Value>& Info, bool PassByPointer);
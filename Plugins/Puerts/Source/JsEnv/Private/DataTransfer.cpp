@@ -65,6 +65,11 @@ v8::Local<v8::Value> DataTransfer::FindOrAddStruct(
     return FV8Utils::IsolateData<IObjectMapper>(Isolate)->FindOrAddStruct(Isolate, Context, ScriptStruct, Ptr, PassByPointer);
 }
 
+void* DataTransfer::AllocStructMemory(v8::Isolate* Isolate, int32 Size, int32 Alignment)
+{
+    return FV8Utils::IsolateData<IObjectMapper>(Isolate)->GetStructMemoryPool()->Alloc(Size, Alignment);
+}
+
 bool DataTransfer::IsInstanceOf(v8::Isolate* Isolate, UStruct* Struct, v8::Local<v8::Value> JsObject)
 {
     return JsObject->IsObject() && FV8Utils::IsolateData<IObjectMapper>(Isolate)->IsInstanceOf(Struct, JsObject.As<v8::Object>());
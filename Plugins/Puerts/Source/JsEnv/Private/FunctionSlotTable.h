@@ -0,0 +1,110 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+#include "NamespaceDef.h"
+
+namespace PUERTS_NAMESPACE
+{
+// UFunction -> per function data of the env (the js function a ts override or a mixin dispatches to), addressed by the
+// GUObjectArray index of the function like FObjectWrapperTable, so a call from blueprint finds it with two indexed loads.
+// slots live in pages that never move, a value found stays at the same address until its function is removed.
+// the owner must Remove a function when it gets deleted (mark it tracked in the wrapper table), which is what keeps a slot from
+// being taken for another function reusing the index.
+template <typename T>
+class TFunctionSlotTable
+{
+public:
+    TFunctionSlotTable() = default;
+
+    TFunctionSlotTable(const TFunctionSlotTable&) = delete;
+    TFunctionSlotTable& operator=(const TFunctionSlotTable&) = delete;
+
+    FORCEINLINE T* Find(const UFunction* Function)
+    {
+        FSlot* Slot = FindSlot(Function);
+        return Slot ? &Slot->Value : nullptr;
+    }
+
+    T& Add(const UFunction* Function, T&& Value)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Function);
+        check(Index >= 0);
+        const int32 PageIndex = Index >> PageBits;
+        if (PageIndex >= Pages.Num())
+        {
+            Pages.SetNum(PageIndex + 1);
+        }
+        if (!Pages[PageIndex])
+        {
+            Pages[PageIndex] = MakeUnique<FSlot[]>(PageSize);
+        }
+        FSlot& Slot = Pages[PageIndex][Index & (PageSize - 1)];
+        if (Slot.Function != Function)
+        {
+            ++NumFunctions;
+        }
+        Slot.Function = Function;
+        Slot.Value = MoveTemp(Value);
+        return Slot.Value;
+    }
+
+    bool Remove(const UFunction* Function)
+    {
+        FSlot* Slot = FindSlot(Function);
+        if (!Slot)
+        {
+            return false;
+        }
+        Slot->Function = nullptr;
+        Slot->Value = T();
+        --NumFunctions;
+        return true;
+    }
+
+    int32 Num() const
+    {
+        return NumFunctions;
+    }
+
+    void Empty()
+    {
+        Pages.Empty();
+        NumFunctions = 0;
+    }
+
+private:
+    static constexpr int32 PageBits = 10;
+    static constexpr int32 PageSize = 1 << PageBits;
+
+    struct FSlot
+    {
+        const UFunction* Function = nullptr;
+        T Value;
+    };
+
+    FORCEINLINE FSlot* FindSlot(const UFunction* Function)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Function);
+        const int32 PageIndex = Index >> PageBits;
+        if (Index < 0 || PageIndex >= Pages.Num() || !Pages[PageIndex])
+        {
+            return nullptr;
+        }
+        FSlot& Slot = Pages[PageIndex][Index & (PageSize - 1)];
+        return Slot.Function == Function ? &Slot : nullptr;
+    }
+
+    TArray<TUniquePtr<FSlot[]>> Pages;
+
+    int32 NumFunctions = 0;
+};
+}    // namespace PUERTS_NAMESPACE
@@ -10,6 +10,13 @@
 #include "V8Utils.h"
 #include "Misc/DefaultValueHelper.h"
 #include <mutex>
+#ifdef WITH_V8_FAST_CALL
+PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#pragma warning(push, 0)
+#include "v8-fast-api-calls.h"
+#pragma warning(pop)
+PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#endif
 
 static TMap<FName, TMap<FName, TMap<FName, FString>>> ParamDefaultMetas;
 
@@ -86,6 +93,156 @@ public:
 static GlobalBufferAutoRelease Dummy;
 #endif
 
+#ifdef WITH_V8_FAST_CALL
+// every signature up to this many arguments gets a CFunction, 4 kinds per argument and 4 return kinds
+static constexpr int32 MaxFastApiArguments = 3;
+
+template <typename T>
+struct TFastApiValue
+{
+};
+
+template <>
+struct TFastApiValue<int32_t>
+{
+    static void Set(FFunctionTranslator::FFastApiValue& Value, int32_t In)
+    {
+        Value.Int32 = In;
+    }
+
+    static int32_t Get(const FFunctionTranslator::FFastApiValue& Value)
+    {
+        return Value.Int32;
+    }
+};
+
+template <>
+struct TFastApiValue<double>
+{
+    static void Set(FFunctionTranslator::FFastApiValue& Value, double In)
+    {
+        Value.Double = In;
+    }
+
+    static double Get(const FFunctionTranslator::FFastApiValue& Value)
+    {
+        return Value.Double;
+    }
+};
+
+template <>
+struct TFastApiValue<bool>
+{
+    static void Set(FFunctionTranslator::FFastApiValue& Value, bool In)
+    {
+        Value.Bool = In;
+    }
+
+    static bool Get(const FFunctionTranslator::FFastApiValue& Value)
+    {
+        return Value.Bool;
+    }
+};
+
+template <>
+struct TFastApiValue<v8::Local<v8::Value>>
+{
+    // same as the object property translator, anything but a wrapper is null
+    static void Set(FFunctionTranslator::FFastApiValue& Value, v8::Local<v8::Value> In)
+    {
+        Value.Object = In->IsObject() ? FV8Utils::GetUObject(In.As<v8::Object>()) : nullptr;
+    }
+};
+
+template <>
+struct TFastApiValue<void>
+{
+    static void Get(const FFunctionTranslator::FFastApiValue& Value)
+    {
+    }
+};
+
+template <typename Ret, typename... Args>
+struct TReflectionFastApiCall
+{
+    static Ret Wrap(v8::Local<v8::Object> Receiver, Args... InArgs, v8::FastApiCallbackOptions& Options)
+    {
+        FFunctionTranslator::FFastApiValue Values[sizeof...(Args) + 1];
+        int32 Index = 0;
+        (void) std::initializer_list<int>{(TFastApiValue<Args>::Set(Values[Index++], InArgs), 0)...};
+
+        FFunctionTranslator* Translator = static_cast<FFunctionTranslator*>(v8::External::Cast(&Options.data)->Value());
+        FFunctionTranslator::FFastApiValue Return;
+        if (!Translator->CallFastApi(Receiver, Values, Return))
+        {
+            Options.fallback = true;
+            return Ret();
+        }
+        return TFastApiValue<Ret>::Get(Return);
+    }
+
+    static const v8::CFunction* Info()
+    {
+        static v8::CFunction CFunction = v8::CFunction::Make(Wrap);
+        return &CFunction;
+    }
+};
+
+// picks the instantiation matching the kinds, one argument at a time
+template <typename Ret, typename... Bound>
+struct TReflectionFastApiSelector
+{
+    static const v8::CFunction* Select(const EFastApiKind* Kinds, int32 Num)
+    {
+        return Select(Kinds, Num, std::integral_constant<bool, (sizeof...(Bound) < MaxFastApiArguments)>());
+    }
+
+private:
+    static const v8::CFunction* Select(const EFastApiKind* Kinds, int32 Num, std::false_type)
+    {
+        return Num == 0 ? TReflectionFastApiCall<Ret, Bound...>::Info() : nullptr;
+    }
+
+    static const v8::CFunction* Select(const EFastApiKind* Kinds, int32 Num, std::true_type)
+    {
+        if (Num == 0)
+        {
+            return TReflectionFastApiCall<Ret, Bound...>::Info();
+        }
+        switch (Kinds[0])
+        {
+            case EFastApiKind::Int32:
+                return TReflectionFastApiSelector<Ret, Bound..., int32_t>::Select(Kinds + 1, Num - 1);
+            case EFastApiKind::Double:
+                return TReflectionFastApiSelector<Ret, Bound..., double>::Select(Kinds + 1, Num - 1);
+            case EFastApiKind::Bool:
+                return TReflectionFastApiSelector<Ret, Bound..., bool>::Select(Kinds + 1, Num - 1);
+            case EFastApiKind::Object:
+                return TReflectionFastApiSelector<Ret, Bound..., v8::Local<v8::Value>>::Select(Kinds + 1, Num - 1);
+            default:
+                return nullptr;
+        }
+    }
+};
+
+static const v8::CFunction* SelectReflectionFastApi(EFastApiKind ReturnKind, const EFastApiKind* Kinds, int32 Num)
+{
+    switch (ReturnKind)
+    {
+        case EFastApiKind::None:
+            return TReflectionFastApiSelector<void>::Select(Kinds, Num);
+        case EFastApiKind::Int32:
+            return TReflectionFastApiSelector<int32_t>::Select(Kinds, Num);
+        case EFastApiKind::Double:
+            return TReflectionFastApiSelector<double>::Select(Kinds, Num);
+        case EFastApiKind::Bool:
+            return TReflectionFastApiSelector<bool>::Select(Kinds, Num);
+        default:
+            return nullptr;
+    }
+}
+#endif
+
 FFunctionTranslator::FFunctionTranslator(UFunction* InFunction, bool IsDelegate)
 {
     Init(InFunction, IsDelegate);
@@ -209,10 +366,389 @@ void FFunctionTranslator::Init(UFunction* InFunction, bool IsDelegate)
             }
         }
     }
+
+    InitFramePlan(InFunction);
+
+#ifdef WITH_V8_FAST_CALL
+    InitFastApi(InFunction, IsDelegate);
+#endif
 }
 
+void FFunctionTranslator::InitFramePlan(UFunction* InFunction)
+{
+    FrameParams.clear();
+    FrameZeroRanges.clear();
+    FrameInitProperties.clear();
+    FrameOutToJsArgs.clear();
+    FrameDestroyArgs.clear();
+    FrameOutProperties.clear();
+    FrameReturnOffset = 0;
+    FrameReturnNeedsDestroy = false;
+    FrameIsScalar = ArgumentDefaultValues == nullptr;
+
+    FrameReturnToJs = [](const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+                          v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info, const void* Params)
+    { Info.GetReturnValue().Set(Translator->UEToJsInContainer(Isolate, Context, Params)); };
+
+    TBitArray<> ZeroBytes(true, ParamsBufferSize);
+    int ArgIndex = 0;
+    for (TFieldIterator<PropertyMacro> It(InFunction); It && (It->PropertyFlags & CPF_Parm); ++It)
+    {
+        PropertyMacro* Property = *It;
+        const bool IsReturn = Property->HasAnyPropertyFlags(CPF_ReturnParm);
+        const int32 PropertyOffset = Property->GetOffset_ForInternal();
+        const bool ByValue = Property->ArrayDim == 1 && !Property->HasAnyPropertyFlags(CPF_OutParm);
+        const bool IsInt32 = ByValue && Property->IsA<IntPropertyMacro>();
+        const bool IsFloat = ByValue && Property->IsA<FloatPropertyMacro>();
+        const bool IsDouble = ByValue && Property->IsA<DoublePropertyMacro>();
+        const bool IsBool =
+            ByValue && Property->IsA<BoolPropertyMacro>() && CastFieldMacro<BoolPropertyMacro>(Property)->IsNativeBool();
+        FrameIsScalar = FrameIsScalar && (IsInt32 || IsFloat || IsDouble || IsBool);
+
+        if (!Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+        {
+            FrameInitProperties.push_back(Property);
+            // a struct constructor may leave members alone, those still get zeroed first
+            if (!Property->IsA<StructPropertyMacro>())
+            {
+                ZeroBytes.SetRange(PropertyOffset, Property->GetSize(), false);
+            }
+        }
+
+        int32 OutIndex = INDEX_NONE;
+        if (Property->HasAnyPropertyFlags(CPF_OutParm))
+        {
+            OutIndex = static_cast<int32>(FrameOutProperties.size());
+            FrameOutProperties.push_back(Property);
+        }
+
+        if (IsReturn)
+        {
+            FrameReturnOffset = PropertyOffset;
+            FrameReturnNeedsDestroy = !Property->HasAnyPropertyFlags(CPF_NoDestructor);
+            if (IsInt32)
+            {
+                FrameReturnToJs = [](const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+                                      v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
+                                      const void* Params)
+                {
+                    Info.GetReturnValue().Set(
+                        v8::Integer::New(Isolate, *reinterpret_cast<const int32*>(static_cast<const uint8*>(Params) + Offset)));
+                };
+            }
+            else if (IsFloat)
+            {
+                FrameReturnToJs = [](const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+                                      v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
+                                      const void* Params)
+                {
+                    Info.GetReturnValue().Set(
+                        v8::Number::New(Isolate, *reinterpret_cast<const float*>(static_cast<const uint8*>(Params) + Offset)));
+                };
+            }
+            else if (IsDouble)
+            {
+                FrameReturnToJs = [](const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+                                      v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
+                                      const void* Params)
+                {
+                    Info.GetReturnValue().Set(
+                        v8::Number::New(Isolate, *reinterpret_cast<const double*>(static_cast<const uint8*>(Params) + Offset)));
+                };
+            }
+            else if (IsBool)
+            {
+                FrameReturnToJs = [](const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+                                      v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
+                                      const void* Params)
+                {
+                    Info.GetReturnValue().Set(
+                        v8::Boolean::New(Isolate, *reinterpret_cast<const bool*>(static_cast<const uint8*>(Params) + Offset)));
+                };
+            }
+            continue;
+        }
+
+        FFrameParam FrameParam;
+        FrameParam.Property = Property;
+        FrameParam.Offset = PropertyOffset;
+        FrameParam.OutIndex = OutIndex;
+        FrameParam.OutToJs = Arguments[ArgIndex]->IsOut();
+        FrameParam.NeedsDestroy =
+            !Property->HasAnyPropertyFlags(CPF_NoDestructor) && Arguments[ArgIndex]->ParamShallowCopySize == 0;
+        if (IsInt32)
+        {
+            FrameParam.JsToUE = [](const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+                               v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params)
+            {
+                *reinterpret_cast<int32*>(static_cast<uint8*>(Params) + Param.Offset) = Value->Int32Value(Context).ToChecked();
+                return true;
+            };
+        }
+        else if (IsFloat)
+        {
+            FrameParam.JsToUE = [](const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+                               v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params)
+            {
+                *reinterpret_cast<float*>(static_cast<uint8*>(Params) + Param.Offset) =
+                    static_cast<float>(Value->NumberValue(Context).ToChecked());
+                return true;
+            };
+        }
+        else if (IsDouble)
+        {
+            FrameParam.JsToUE = [](const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+                               v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params)
+            {
+                *reinterpret_cast<double*>(static_cast<uint8*>(Params) + Param.Offset) = Value->NumberValue(Context).ToChecked();
+                return true;
+            };
+        }
+        else if (IsBool)
+        {
+            FrameParam.JsToUE = [](const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+                               v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params)
+            {
+                *reinterpret_cast<bool*>(static_cast<uint8*>(Params) + Param.Offset) = Value->BooleanValue(Isolate);
+                return true;
+            };
+        }
+        else
+        {
+            FrameParam.JsToUE = [](const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+                               v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params)
+            { return Translator->JsToUEInContainer(Isolate, Context, Value, Params, false); };
+        }
+
+        if (FrameParam.OutToJs)
+        {
+            FrameOutToJsArgs.push_back(ArgIndex);
+        }
+        if (FrameParam.NeedsDestroy)
+        {
+            FrameDestroyArgs.push_back(ArgIndex);
+        }
+        FrameParams.push_back(FrameParam);
+        ++ArgIndex;
+    }
+
+    for (TConstSetBitIterator<> It(ZeroBytes); It; ++It)
+    {
+        const int32 Offset = It.GetIndex();
+        if (!FrameZeroRanges.empty() && FrameZeroRanges.back().Offset + FrameZeroRanges.back().Size == Offset)
+        {
+            ++FrameZeroRanges.back().Size;
+        }
+        else
+        {
+            FrameZeroRanges.push_back({Offset, 1});
+        }
+    }
+}
+
+#ifdef WITH_V8_FAST_CALL
+bool FFunctionTranslator::GetFastApiParam(PropertyMacro* Property, bool IsReturn, FFastApiParam& OutParam)
+{
+    if (Property->ArrayDim != 1 || (!IsReturn && Property->HasAnyPropertyFlags(CPF_OutParm)))
+    {
+        return false;
+    }
+
+    // the same types the int32 translator handles
+    auto IsInt32 = [](PropertyMacro* InProperty)
+    {
+        return InProperty->IsA<BytePropertyMacro>() || InProperty->IsA<Int8PropertyMacro>() ||
+               InProperty->IsA<Int16PropertyMacro>() || InProperty->IsA<IntPropertyMacro>() ||
+               InProperty->IsA<UInt16PropertyMacro>();
+    };
+
+    OutParam.Property = Property;
+    OutParam.ValueProperty = Property;
+    if (IsInt32(Property))
+    {
+        OutParam.Kind = EFastApiKind::Int32;
+    }
+    else if (Property->IsA<DoublePropertyMacro>() || Property->IsA<FloatPropertyMacro>())
+    {
+        OutParam.Kind = EFastApiKind::Double;
+    }
+    else if (Property->IsA<BoolPropertyMacro>())
+    {
+        OutParam.Kind = EFastApiKind::Bool;
+    }
+    else if (Property->IsA<EnumPropertyMacro>() && IsInt32(CastFieldMacro<EnumPropertyMacro>(Property)->GetUnderlyingProperty()))
+    {
+        OutParam.Kind = EFastApiKind::Int32;
+        OutParam.ValueProperty = CastFieldMacro<EnumPropertyMacro>(Property)->GetUnderlyingProperty();
+    }
+    else if (!IsReturn && !Property->IsA<ClassPropertyMacro>() &&
+             (Property->IsA<ObjectPropertyMacro>() || Property->IsA<WeakObjectPropertyMacro>() ||
+                 Property->IsA<LazyObjectPropertyMacro>()))
+    {
+        // returning an object needs its wrapper, which can't be created from a fast call
+        OutParam.Kind = EFastApiKind::Object;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// native classes, never collected, whose owner vouched that their functions don't reenter js nor destroy objects
+static TSet<const UClass*>& GetFastApiClasses()
+{
+    static TSet<const UClass*> Classes;
+    return Classes;
+}
+
+void FFunctionTranslator::AllowFastApi(UClass* Class)
+{
+    check(IsInGameThread());
+    if (Class && Class->HasAnyClassFlags(CLASS_Native))
+    {
+        GetFastApiClasses().Add(Class);
+    }
+}
+
+void FFunctionTranslator::InitFastApi(UFunction* InFunction, bool IsDelegate)
+{
+    FastApiInfo = nullptr;
+    FastApiParams.clear();
+
+    // optimized code can't be reentered, const or pure don't guarantee a function stays out of js (it may fire a delegate or
+    // destroy an object), so only classes opted in with FJsEnv::AllowFastApiCalls qualify. even then, no events (js can
+    // override them), no net functions and nothing that needs a lookup per call
+    if (IsDelegate || IsInterfaceFunction || SkipWorldContextInArg0 || ArgumentDefaultValues ||
+        Arguments.size() > MaxFastApiArguments || !InFunction->HasAnyFunctionFlags(FUNC_Native) ||
+        InFunction->HasAnyFunctionFlags(FUNC_Net | FUNC_Event | FUNC_BlueprintEvent | FUNC_UbergraphFunction) ||
+        !GetFastApiClasses().Contains(InFunction->GetOuterUClass()))
+    {
+        return;
+    }
+
+    EFastApiKind Kinds[MaxFastApiArguments];
+    for (int i = 0; i < Arguments.size(); ++i)
+    {
+        FFastApiParam Param;
+        if (!GetFastApiParam(Arguments[i]->Property, false, Param))
+        {
+            FastApiParams.clear();
+            return;
+        }
+        Kinds[i] = Param.Kind;
+        FastApiParams.push_back(Param);
+    }
+
+    FastApiReturn = {EFastApiKind::None, nullptr, nullptr};
+    if (Return && !GetFastApiParam(Return->Property, true, FastApiReturn))
+    {
+        FastApiParams.clear();
+        return;
+    }
+
+    FastApiNativeFunc = InFunction->GetNativeFunc();
+    FastApiInfo = SelectReflectionFastApi(FastApiReturn.Kind, Kinds, static_cast<int32>(FastApiParams.size()));
+}
+
+bool FFunctionTranslator::CallFastApi(v8::Local<v8::Object> Receiver, const FFastApiValue* InArgs, FFastApiValue& OutReturn)
+{
+    UFunction* CallFunction = Function.Get();
+    UObject* CallObject = IsStatic ? BindObject.Get() : FV8Utils::GetUObject(Receiver);
+    // a mixin or a js override swaps the native function of the UFunction
+    if (!CallFunction || !CallObject || FV8Utils::IsReleasedPtr(CallObject) || FastApiInfo != BoundFastApiInfo ||
+        CallFunction->GetNativeFunc() != FastApiNativeFunc)
+    {
+        return false;
+    }
+
+#if defined(USE_GLOBAL_PARAMS_BUFFER)
+    void* Params = Buffer;
+#else
+    void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
+#endif
+    if (Params)
+    {
+        // every parameter is a scalar, zero is their initialized value
+        FMemory::Memzero(Params, ParamsBufferSize);
+    }
+
+    for (int i = 0; i < FastApiParams.size(); ++i)
+    {
+        const FFastApiParam& Param = FastApiParams[i];
+        void* ValuePtr = Param.Property->ContainerPtrToValuePtr<void>(Params);
+        switch (Param.Kind)
+        {
+            case EFastApiKind::Int32:
+                static_cast<NumericPropertyMacro*>(Param.ValueProperty)
+                    ->SetIntPropertyValue(ValuePtr, static_cast<uint64>(InArgs[i].Int32));
+                break;
+            case EFastApiKind::Double:
+                static_cast<NumericPropertyMacro*>(Param.ValueProperty)
+                    ->SetFloatingPointPropertyValue(ValuePtr, InArgs[i].Double);
+                break;
+            case EFastApiKind::Bool:
+                static_cast<BoolPropertyMacro*>(Param.ValueProperty)->SetPropertyValue(ValuePtr, InArgs[i].Bool);
+                break;
+            case EFastApiKind::Object:
+                if (FV8Utils::IsReleasedPtr(InArgs[i].Object))
+                {
+                    // the regular callback throws for it
+                    return false;
+                }
+                static_cast<ObjectPropertyBaseMacro*>(Param.ValueProperty)
+                    ->SetObjectPropertyValue(ValuePtr, InArgs[i].Object);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    FFrame NewStack(CallObject, CallFunction, Params, nullptr,
+#if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
+        CallFunction->ChildProperties
+#else
+        CallFunction->Children
+#endif
+    );
+    const bool bHasReturnParam = CallFunction->ReturnValueOffset != MAX_uint16;
+    uint8* ReturnValueAddress = bHasReturnParam ? ((uint8*) Params + CallFunction->ReturnValueOffset) : nullptr;
+    CallFunction->Invoke(CallObject, NewStack, ReturnValueAddress);
+
+    if (FastApiReturn.Kind != EFastApiKind::None)
+    {
+        const void* ValuePtr = FastApiReturn.Property->ContainerPtrToValuePtr<void>(Params);
+        PropertyMacro* ValueProperty = FastApiReturn.ValueProperty;
+        switch (FastApiReturn.Kind)
+        {
+            case EFastApiKind::Int32:
+                OutReturn.Int32 =
+                    static_cast<int32>(static_cast<NumericPropertyMacro*>(ValueProperty)->GetSignedIntPropertyValue(ValuePtr));
+                break;
+            case EFastApiKind::Double:
+                OutReturn.Double = static_cast<NumericPropertyMacro*>(ValueProperty)->GetFloatingPointPropertyValue(ValuePtr);
+                break;
+            case EFastApiKind::Bool:
+                OutReturn.Bool = static_cast<BoolPropertyMacro*>(ValueProperty)->GetPropertyValue(ValuePtr);
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+#endif
+
 v8::Local<v8::FunctionTemplate> FFunctionTranslator::ToFunctionTemplate(v8::Isolate* Isolate)
 {
+#ifdef WITH_V8_FAST_CALL
+    BoundFastApiInfo = FastApiInfo;
+    if (FastApiInfo)
+    {
+        return v8::FunctionTemplate::New(Isolate, Call, v8::External::New(Isolate, this), v8::Local<v8::Signature>(), 0,
+            v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect, FastApiInfo);
+    }
+#endif
     return v8::FunctionTemplate::New(Isolate, Call, v8::External::New(Isolate, this));
 }
 
@@ -249,11 +785,6 @@ void FFunctionTranslator::Call(
     }
     TWeakObjectPtr<UFunction> CallFunction =
         !IsInterfaceFunction ? Function : (CallObject->GetClass()->FindFunctionByName(Function->GetFName()));
-#if defined(USE_GLOBAL_PARAMS_BUFFER)
-    void* Params = Buffer;
-#else
-    void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
-#endif
 #if WITH_EDITOR
     if (!CallFunction.IsValid())
     {
@@ -261,12 +792,25 @@ void FFunctionTranslator::Call(
         Init(CallFunction.Get(), false);
     }
 #endif
+#if defined(USE_GLOBAL_PARAMS_BUFFER)
+    void* Params = Buffer;
+#else
+    FFrameScope FrameScope(this);
+    void* Params = FrameScope.Frame ? FrameScope.Frame : (ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr);
+#endif
 
     auto CallFunctionPtr = CallFunction.Get();
     if ((Function->FunctionFlags & FUNC_Native) && !(Function->FunctionFlags & FUNC_Net) &&
         !CallFunctionPtr->HasAnyFunctionFlags(FUNC_UbergraphFunction))
     {
-        FastCall(Isolate, Context, Info, CallObject, CallFunctionPtr, Params);
+        if (FrameIsScalar)
+        {
+            FastCallScalar(Isolate, Context, Info, CallObject, CallFunctionPtr, Params);
+        }
+        else
+        {
+            FastCall(Isolate, Context, Info, CallObject, CallFunctionPtr, Params);
+        }
     }
     else
     {
@@ -279,7 +823,7 @@ void FFunctionTranslator::SlowCall(v8::Isolate* Isolate, v8::Local<v8::Context>&
 {
     if (Params)
     {
-        FMemory::Memzero(Params, ParamsBufferSize);
+        InitFrame(Params);
     }
 
     if (!Call_ProcessParams(Isolate, Context, Info, Params, 0))
@@ -297,11 +841,7 @@ void FFunctionTranslator::FastCall(v8::Isolate* Isolate, v8::Local<v8::Context>&
 {
     if (Params)
     {
-        FMemory::Memzero(Params, ParamsBufferSize);
-        if (Return)
-        {
-            Return->Property->InitializeValue_InContainer(Params);
-        }
+        InitFrame(Params);
     }
     FFrame NewStack(CallObject, CallFunction, Params, nullptr,
 #if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
@@ -312,72 +852,51 @@ void FFunctionTranslator::FastCall(v8::Isolate* Isolate, v8::Local<v8::Context>&
     );
 
     checkSlow(NewStack.Locals || Function->ParmsSize == 0);
-    FOutParmRec** LastOut = &NewStack.OutParms;
-    int Index = 0;
-    for (TFieldIterator<PropertyMacro> It(CallFunction); It && (It->PropertyFlags & CPF_Parm); ++It)
+    const int32 NumOuts = static_cast<int32>(FrameOutProperties.size());
+    FOutParmRec* Outs = nullptr;
+    if (NumOuts > 0)
     {
-        PropertyMacro* Property = *It;
-        FOutParmRec* Out = nullptr;
-        if (Property->HasAnyPropertyFlags(CPF_OutParm))
+        CA_SUPPRESS(6263)
+        Outs = (FOutParmRec*) FMemory_Alloca(sizeof(FOutParmRec) * NumOuts);
+        for (int32 i = 0; i < NumOuts; ++i)
         {
-            CA_SUPPRESS(6263)
-            Out = (FOutParmRec*) FMemory_Alloca(sizeof(FOutParmRec));
-            Out->Property = Property;
-
-            if (*LastOut)
-            {
-                (*LastOut)->NextOutParm = Out;
-                LastOut = &(*LastOut)->NextOutParm;
-            }
-            else
-            {
-                *LastOut = Out;
-            }
+            Outs[i].Property = FrameOutProperties[i];
+            Outs[i].PropAddr = FrameOutProperties[i]->ContainerPtrToValuePtr<uint8>(Params);
+            Outs[i].NextOutParm = i + 1 < NumOuts ? &Outs[i + 1] : nullptr;
         }
-
-        if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+        if (UNLIKELY(CallFunction != Function.Get()))
         {
-            if (Property->HasAnyPropertyFlags(CPF_OutParm))
+            // an interface implementation has its own properties, same layout
+            int32 i = 0;
+            for (TFieldIterator<PropertyMacro> It(CallFunction); It && (It->PropertyFlags & CPF_Parm) && i < NumOuts; ++It)
             {
-                Out->PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
+                if (It->HasAnyPropertyFlags(CPF_OutParm))
+                {
+                    Outs[i++].Property = *It;
+                }
             }
-            continue;
         }
+        NewStack.OutParms = Outs;
+    }
 
-        if (UNLIKELY(ArgumentDefaultValues && Info[Index]->IsUndefined()))
+    for (int i = 0; i < Arguments.size(); ++i)
+    {
+        const FFrameParam& Param = FrameParams[i];
+        if (UNLIKELY(ArgumentDefaultValues && Info[i]->IsUndefined()))
         {
-            Property->CopyCompleteValue_InContainer(Params, ArgumentDefaultValues);
-            if (Property->HasAnyPropertyFlags(CPF_OutParm))
-            {
-                Out->PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
-            }
+            Param.Property->CopyCompleteValue_InContainer(Params, ArgumentDefaultValues);
         }
-        else
+        else if (Param.OutIndex != INDEX_NONE)
         {
-            Property->InitializeValue_InContainer(Params);
-            if (Property->HasAnyPropertyFlags(CPF_OutParm))
+            if (!Arguments[i]->JsToUEFastInContainer(
+                    Isolate, Context, Info[i], Params, reinterpret_cast<void**>(&(Outs[Param.OutIndex].PropAddr))))
             {
-                if (!Arguments[Index]->JsToUEFastInContainer(
-                        Isolate, Context, Info[Index], Params, reinterpret_cast<void**>(&(Out->PropAddr))))
-                {
-                    return;
-                }
-            }
-            else
-            {
-                if (!Arguments[Index]->JsToUEInContainer(Isolate, Context, Info[Index], Params, false))
-                {
-                    return;
-                }
+                return;
             }
         }
-        ++Index;
-    }
-    if (CallFunction->HasAnyFunctionFlags(FUNC_HasOutParms))
-    {
-        if (*LastOut)
+        else if (!Param.JsToUE(Arguments[i].get(), Param, Isolate, Context, Info[i], Params))
         {
-            (*LastOut)->NextOutParm = NULL;
+            return;
         }
     }
 
@@ -387,34 +906,63 @@ void FFunctionTranslator::FastCall(v8::Isolate* Isolate, v8::Local<v8::Context>&
 
     if (Return)
     {
-        Info.GetReturnValue().Set(Return->UEToJsInContainer(Isolate, Context, Params));
-        Return->Property->DestroyValue_InContainer(Params);
+        FrameReturnToJs(Return.get(), FrameReturnOffset, Isolate, Context, Info, Params);
+        if (FrameReturnNeedsDestroy)
+        {
+            Return->Property->DestroyValue_InContainer(Params);
+        }
     }
 
-    LastOut = &NewStack.OutParms;
-    for (int i = 0; i < Arguments.size(); ++i)
+    for (int32 i : FrameOutToJsArgs)
     {
-        auto PropertyFlags = Arguments[i]->Property->PropertyFlags;
-        if (PropertyFlags & CPF_OutParm)
+        // a struct passed by reference may point at the js owned instance, which needs no copy back
+        const uint8* PropAddr = Outs[FrameParams[i].OutIndex].PropAddr;
+        if (PropAddr >= (uint8*) Params && PropAddr < ((uint8*) Params + ParamsBufferSize))
         {
-            if ((PropertyFlags & CPF_Parm) && (!(PropertyFlags & CPF_ConstParm)) && (!(PropertyFlags & CPF_ReturnParm)))
-            {
-                if ((*LastOut)->PropAddr >= (uint8*) Params && (*LastOut)->PropAddr < ((uint8*) Params + ParamsBufferSize))
-                {
-                    Arguments[i]->UEOutToJsInContainer(Isolate, Context, Info[i], Params, false);
-                }
-                else
-                {
-                    LastOut = &(*LastOut)->NextOutParm;
-                    continue;
-                }
-            }
-            LastOut = &(*LastOut)->NextOutParm;
+            Arguments[i]->UEOutToJsInContainer(Isolate, Context, Info[i], Params, false);
         }
-        if (Arguments[i]->ParamShallowCopySize == 0)
+    }
+
+    for (int32 i : FrameDestroyArgs)
+    {
+        const FFrameParam& Param = FrameParams[i];
+        if (Param.OutToJs)
         {
-            Arguments[i]->Property->DestroyValue_InContainer(Params);
+            const uint8* PropAddr = Outs[Param.OutIndex].PropAddr;
+            if (PropAddr < (uint8*) Params || PropAddr >= ((uint8*) Params + ParamsBufferSize))
+            {
+                continue;
+            }
         }
+        Param.Property->DestroyValue_InContainer(Params);
+    }
+}
+
+void FFunctionTranslator::FastCallScalar(v8::Isolate* Isolate, v8::Local<v8::Context>& Context,
+    const v8::FunctionCallbackInfo<v8::Value>& Info, UObject* CallObject, UFunction* CallFunction, void* Params)
+{
+    // every parameter is written before the call and the native function writes the return, nothing to zero or clean up
+    for (int i = 0; i < Arguments.size(); ++i)
+    {
+        const FFrameParam& Param = FrameParams[i];
+        Param.JsToUE(Arguments[i].get(), Param, Isolate, Context, Info[i], Params);
+    }
+
+    FFrame NewStack(CallObject, CallFunction, Params, nullptr,
+#if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
+        Function->ChildProperties
+#else
+        Function->Children
+#endif
+    );
+
+    const bool bHasReturnParam = CallFunction->ReturnValueOffset != MAX_uint16;
+    uint8* ReturnValueAddress = bHasReturnParam ? ((uint8*) Params + CallFunction->ReturnValueOffset) : nullptr;
+    CallFunction->Invoke(CallObject, NewStack, ReturnValueAddress);
+
+    if (Return)
+    {
+        FrameReturnToJs(Return.get(), FrameReturnOffset, Isolate, Context, Info, Params);
     }
 }
 
@@ -424,10 +972,11 @@ void FFunctionTranslator::Call(v8::Isolate* Isolate, v8::Local<v8::Context>& Con
 #if defined(USE_GLOBAL_PARAMS_BUFFER)
     void* Params = Buffer;
 #else
-    void* Params = ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr;
+    FFrameScope FrameScope(this);
+    void* Params = FrameScope.Frame ? FrameScope.Frame : (ParamsBufferSize > 0 ? FMemory_Alloca(ParamsBufferSize) : nullptr);
 #endif
     if (Params)
-        FMemory::Memzero(Params, ParamsBufferSize);
+        InitFrame(Params);
 
     Call_ProcessParams(Isolate, Context, Info, Params, 0);
 
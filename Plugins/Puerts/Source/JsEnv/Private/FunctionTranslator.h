@@ -27,6 +27,18 @@ PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
 
 namespace PUERTS_NAMESPACE
 {
+#ifdef WITH_V8_FAST_CALL
+// c type a reflected parameter is passed as when optimized code calls the function through the v8 fast api
+enum class EFastApiKind : uint8
+{
+    None,    // void return
+    Int32,
+    Double,
+    Bool,
+    Object
+};
+#endif
+
 class FFunctionTranslator
 {
 public:
@@ -38,6 +50,10 @@ public:
         {
             FMemory::Free(ArgumentDefaultValues);
         }
+        if (CachedFrame)
+        {
+            FMemory::Free(CachedFrame);
+        }
     }
 
     virtual v8::Local<v8::FunctionTemplate> ToFunctionTemplate(v8::Isolate* Isolate);
@@ -53,24 +69,46 @@ public:
 
     bool IsValid() const;
 
+#ifdef WITH_V8_FAST_CALL
+    union FFastApiValue
+    {
+        int32 Int32;
+        double Double;
+        bool Bool;
+        UObject* Object;
+    };
+
+    // called by optimized code, so it must not touch the js heap. returns false, having called nothing, if the call has to go
+    // through the regular callback (released object, function changed since the template was made...)
+    bool CallFastApi(v8::Local<v8::Object> Receiver, const FFastApiValue* InArgs, FFastApiValue& OutReturn);
+
+    static void AllowFastApi(UClass* Class);
+#endif
+
 protected:
-    FORCEINLINE bool Call_ProcessParams(v8::Isolate* Isolate, v8::Local<v8::Context>& Context,
-        const v8::FunctionCallbackInfo<v8::Value>& Info, void* Params, int StartPos)
+    FORCEINLINE void InitFrame(void* Params)
     {
-        if (Return)
+        for (const FFrameZeroRange& Range : FrameZeroRanges)
         {
-            Return->Property->InitializeValue_InContainer(Params);
+            FMemory::Memzero(static_cast<uint8*>(Params) + Range.Offset, Range.Size);
         }
+        for (PropertyMacro* Property : FrameInitProperties)
+        {
+            Property->InitializeValue_InContainer(Params);
+        }
+    }
 
+    FORCEINLINE bool Call_ProcessParams(v8::Isolate* Isolate, v8::Local<v8::Context>& Context,
+        const v8::FunctionCallbackInfo<v8::Value>& Info, void* Params, int StartPos)
+    {
         for (int i = StartPos; i < Arguments.size(); ++i)
         {
-            Arguments[i]->Property->InitializeValue_InContainer(Params);
-
+            const FFrameParam& Param = FrameParams[i];
             if (UNLIKELY(ArgumentDefaultValues && Info[i - StartPos]->IsUndefined()))
             {
-                Arguments[i]->Property->CopyCompleteValue_InContainer(Params, ArgumentDefaultValues);
+                Param.Property->CopyCompleteValue_InContainer(Params, ArgumentDefaultValues);
             }
-            else if (!Arguments[i]->JsToUEInContainer(Isolate, Context, Info[i - StartPos], Params, false))
+            else if (!Param.JsToUE(Arguments[i].get(), Param, Isolate, Context, Info[i - StartPos], Params))
             {
                 return false;
             }
@@ -83,20 +121,87 @@ protected:
     {
         if (Return)
         {
-            Info.GetReturnValue().Set(Return->UEToJsInContainer(Isolate, Context, Params));
-            Return->Property->DestroyValue_InContainer(Params);
+            FrameReturnToJs(Return.get(), FrameReturnOffset, Isolate, Context, Info, Params);
+            if (FrameReturnNeedsDestroy)
+            {
+                Return->Property->DestroyValue_InContainer(Params);
+            }
+        }
+
+        for (int32 i : FrameOutToJsArgs)
+        {
+            if (i >= StartPos)
+            {
+                Arguments[i]->UEOutToJsInContainer(Isolate, Context, Info[i - StartPos], Params, false);
+            }
         }
 
-        for (int i = StartPos; i < Arguments.size(); ++i)
+        for (int32 i : FrameDestroyArgs)
         {
-            Arguments[i]->UEOutToJsInContainer(Isolate, Context, Info[i - StartPos], Params, false);
-            if (Arguments[i]->ParamShallowCopySize == 0)
+            if (i >= StartPos)
             {
-                Arguments[i]->Property->DestroyValue_InContainer(Params);
+                FrameParams[i].Property->DestroyValue_InContainer(Params);
             }
         }
     }
 
+    struct FFrameParam;
+
+    typedef bool (*FFrameJsToUEFunc)(const FPropertyTranslator* Translator, const FFrameParam& Param, v8::Isolate* Isolate,
+        v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* Params);
+
+    typedef void (*FFrameReturnToJsFunc)(const FPropertyTranslator* Translator, int32 Offset, v8::Isolate* Isolate,
+        v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info, const void* Params);
+
+    // how a call handles one argument, worked out once in Init instead of looking at the property flags on every call
+    struct FFrameParam
+    {
+        PropertyMacro* Property;
+
+        int32 Offset;
+
+        // scalars write straight into the frame, the rest goes through the translator
+        FFrameJsToUEFunc JsToUE;
+
+        // index of the argument in the FOutParmRec chain of a native call, INDEX_NONE if it is not passed by reference
+        int32 OutIndex;
+
+        // written back to the $ref object after the call
+        bool OutToJs;
+
+        bool NeedsDestroy;
+    };
+
+    struct FFrameZeroRange
+    {
+        int32 Offset;
+        int32 Size;
+    };
+
+    std::vector<FFrameParam> FrameParams;
+
+    // bytes of the frame no constructor fully writes, adjacent ones merged
+    std::vector<FFrameZeroRange> FrameZeroRanges;
+
+    // parameters (return included) which are not zero constructible
+    std::vector<PropertyMacro*> FrameInitProperties;
+
+    std::vector<int32> FrameOutToJsArgs;
+
+    std::vector<int32> FrameDestroyArgs;
+
+    // every CPF_OutParm parameter in declaration order (return included), the layout of the FOutParmRec chain
+    std::vector<PropertyMacro*> FrameOutProperties;
+
+    FFrameReturnToJsFunc FrameReturnToJs;
+
+    int32 FrameReturnOffset;
+
+    bool FrameReturnNeedsDestroy;
+
+    // only scalars passed by value and no default values, a native call needs neither zeroing nor cleanup
+    bool FrameIsScalar;
+
     std::vector<std::unique_ptr<FPropertyTranslator>> Arguments;
 
     std::unique_ptr<FPropertyTranslator> Return;
@@ -128,8 +233,85 @@ private:
     void FastCall(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
         UObject* CallObject, UFunction* CallFunction, void* Params);
 
+    void FastCallScalar(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info,
+        UObject* CallObject, UFunction* CallFunction, void* Params);
+
     void Init(UFunction* InFunction, bool IsDelegate);
 
+    void InitFramePlan(UFunction* InFunction);
+
+    // hands the cached frame to the outermost call, nullptr while it is taken (js reentering the same function from
+    // ProcessEvent), in which case the caller falls back to a stack frame
+    FORCEINLINE void* AcquireFrame()
+    {
+        if (CachedFrameInUse || ParamsBufferSize == 0)
+        {
+            return nullptr;
+        }
+        if (CachedFrameSize < ParamsBufferSize)
+        {
+            if (CachedFrame)
+            {
+                FMemory::Free(CachedFrame);
+            }
+            CachedFrame = FMemory::Malloc(ParamsBufferSize, 16);
+            CachedFrameSize = ParamsBufferSize;
+        }
+        CachedFrameInUse = true;
+        return CachedFrame;
+    }
+
+    struct FFrameScope
+    {
+        explicit FFrameScope(FFunctionTranslator* InOwner) : Owner(InOwner), Frame(InOwner->AcquireFrame())
+        {
+        }
+
+        ~FFrameScope()
+        {
+            if (Frame)
+            {
+                Owner->CachedFrameInUse = false;
+            }
+        }
+
+        FFunctionTranslator* Owner;
+
+        void* Frame;
+    };
+
+    void* CachedFrame = nullptr;
+
+    uint32 CachedFrameSize = 0;
+
+    bool CachedFrameInUse = false;
+
+#ifdef WITH_V8_FAST_CALL
+    struct FFastApiParam
+    {
+        EFastApiKind Kind;
+        // the parameter itself, and the property that reads or writes its value (the underlying one for enums)
+        PropertyMacro* Property;
+        PropertyMacro* ValueProperty;
+    };
+
+    static bool GetFastApiParam(PropertyMacro* Property, bool IsReturn, FFastApiParam& OutParam);
+
+    void InitFastApi(UFunction* InFunction, bool IsDelegate);
+
+    // CFunction matching the signature, nullptr if the function has to stay on the regular callback
+    const v8::CFunction* FastApiInfo = nullptr;
+
+    // the one the function template was created with, it no longer matches if the function got reinitialized
+    const v8::CFunction* BoundFastApiInfo = nullptr;
+
+    FNativeFuncPtr FastApiNativeFunc = nullptr;
+
+    std::vector<FFastApiParam> FastApiParams;
+
+    FFastApiParam FastApiReturn;
+#endif
+
     friend class FStructWrapper;
     friend class FJsEnvImpl;
 };
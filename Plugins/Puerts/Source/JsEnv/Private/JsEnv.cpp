@@ -8,6 +8,7 @@
 
 #include "JsEnv.h"
 #include "JsEnvImpl.h"
+#include "FunctionTranslator.h"
 
 namespace PUERTS_NAMESPACE
 {
@@ -76,6 +77,13 @@ void FJsEnv::InitExtensionMethodsMap()
     GameScript->InitExtensionMethodsMap();
 }
 
+void FJsEnv::AllowFastApiCalls(UClass* Class)
+{
+#ifdef WITH_V8_FAST_CALL
+    FFunctionTranslator::AllowFastApi(Class);
+#endif
+}
+
 void FJsEnv::ReloadModule(FName ModuleName, const FString& JsSource)
 {
     GameScript->ReloadModule(ModuleName, JsSource);
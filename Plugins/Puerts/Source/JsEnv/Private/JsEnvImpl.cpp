@@ -18,6 +18,7 @@
 #include "V8Utils.h"
 #include "ObjectMapper.h"
 #include "JSLogger.h"
+#include "PuertsStats.h"
 #if !defined(ENGINE_INDEPENDENT_JSENV)
 #include "JSGeneratedClass.h"
 #include "JSWidgetGeneratedClass.h"
@@ -89,6 +90,8 @@ PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
 void InitWebsocketPPWrap(v8::Local<v8::Context> Context);
 #endif
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("TryBindJs Slow Path"), STAT_PuertsTryBindJsSlowPath, STATGROUP_Puerts);
+
 namespace PUERTS_NAMESPACE
 {
 #if !defined(WITH_QUICKJS)
@@ -350,6 +353,10 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
 {
     GUObjectArray.AddUObjectDeleteListener(static_cast<FUObjectArray::FUObjectDeleteListener*>(this));
 
+#if !defined(ENGINE_INDEPENDENT_JSENV)
+    ClassSkipBindBits.Init(false, GUObjectArray.GetObjectArrayCapacity());
+#endif
+
     if (!InFlags.IsEmpty())
     {
 #if !defined(WITH_NODEJS) && !defined(WITH_QUICKJS)
@@ -654,7 +661,9 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
 #endif
 
     DelegateProxiesCheckerHandler =
-        FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::CheckDelegateProxies), 1);
+        FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::CheckDelegateProxies), 0);
+
+    TimerTickerHandle = FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::TickTimers), 0);
 
     ManualReleaseCallbackMap.Reset(Isolate, v8::Map::New(Isolate));
 
@@ -739,6 +748,7 @@ FJsEnvImpl::~FJsEnvImpl()
     JsPromiseRejectCallback.Reset();
 
     FUETicker::GetCoreTicker().RemoveTicker(DelegateProxiesCheckerHandler);
+    FUETicker::GetCoreTicker().RemoveTicker(TimerTickerHandle);
 
     {
         auto Isolate = MainIsolate;
@@ -753,6 +763,7 @@ FJsEnvImpl::~FJsEnvImpl()
         CppObjectMapper.UnInitialize(Isolate);
 
         ObjectMap.Empty();
+        NameStringCache.Empty();
 
         for (auto& KV : StructCache)
         {
@@ -798,6 +809,8 @@ FJsEnvImpl::~FJsEnvImpl()
             }
             Iter->second.JsCallbacks.Reset();
         }
+        DelegatesByOwner.Empty();
+        DelegateSweepQueue.Empty();
 
         for (auto& KV : AutoReleaseCallbacksMap)
         {
@@ -821,9 +834,9 @@ FJsEnvImpl::~FJsEnvImpl()
         for (auto Iter = TimerInfos.CreateIterator(); Iter; ++Iter)
         {
             Iter->Value.Callback.Reset();
-            FUETicker::GetCoreTicker().RemoveTicker(Iter->Value.TickerHandle);
         }
         TimerInfos.Empty();
+        TimerWheel.Empty();
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
         for (auto& GeneratedClass : GeneratedClasses)
@@ -926,6 +939,8 @@ FJsEnvImpl::~FJsEnvImpl()
         }
     }
     StructCache.Empty();
+    // everything js held is freed by now, the slabs go back in one go
+    StructMemoryPool.Reset();
 }
 
 void FJsEnvImpl::InitExtensionMethodsMap()
@@ -1133,7 +1148,7 @@ void FJsEnvImpl::NewStructByScriptStruct(const v8::FunctionCallbackInfo<v8::Valu
 
     if (ScriptStruct)
     {
-        void* Ptr = FScriptStructWrapper::Alloc(ScriptStruct);
+        void* Ptr = FScriptStructWrapper::Alloc(ScriptStruct, &StructMemoryPool);
 
         Info.GetReturnValue().Set(
             FV8Utils::IsolateData<IObjectMapper>(Isolate)->FindOrAddStruct(Isolate, Context, ScriptStruct, Ptr, false));
@@ -1264,6 +1279,7 @@ void FJsEnvImpl::MakeSureInject(UTypeScriptGeneratedClass* TypeScriptGeneratedCl
                 BindInfo.Prototype.Reset(Isolate, v8::Object::New(Isolate));
                 BindInfo.InjectNotFinished = true;
                 BindInfoMap.Emplace(TypeScriptGeneratedClass, std::move(BindInfo));
+                ObjectMap.MarkTracked(TypeScriptGeneratedClass);
             }
 
             v8::TryCatch TryCatch(Isolate);
@@ -1368,6 +1384,7 @@ void FJsEnvImpl::MakeSureInject(UTypeScriptGeneratedClass* TypeScriptGeneratedCl
                                             Function, {v8::UniquePersistent<v8::Function>(
                                                            Isolate, v8::Local<v8::Function>::Cast(MaybeValue.ToLocalChecked())),
                                                           std::make_unique<FFunctionTranslator>(Function, false)});
+                                        ObjectMap.MarkTracked(Function);
                                     }
                                     else
                                     {
@@ -1549,14 +1566,23 @@ void FJsEnvImpl::OnSourceLoaded(std::function<void(const FString&)> Callback)
 #if !defined(ENGINE_INDEPENDENT_JSENV)
 void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
 {
+    UClass* Class = InObject->GetClass();
+
+    // common case: an instance of a class already known to have nothing to bind
+    const int32 ClassIndex = GUObjectArray.ObjectToIndex(Class);
+    if (LIKELY(ClassIndex < ClassSkipBindBits.Num() && ClassSkipBindBits[ClassIndex]))
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_PuertsTryBindJsSlowPath);
+
     UObjectBaseUtility* Object = static_cast<UObjectBaseUtility*>(const_cast<UObjectBase*>(InObject));
 
     const bool IsCDO = Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
 
     // if (!Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
     {
-        UClass* Class = InObject->GetClass();
-
         auto TypeScriptGeneratedClass = Cast<UTypeScriptGeneratedClass>(Class);
 
         if (UNLIKELY(TypeScriptGeneratedClass))
@@ -1601,6 +1627,8 @@ void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
         else if (UNLIKELY(!IsCDO && Class == UTypeScriptGeneratedClass::StaticClass()))
         {
             TypeScriptGeneratedClass = static_cast<UTypeScriptGeneratedClass*>(Object);
+            // the new class may sit on the index of a deleted one, its CDO has to take the slow path
+            InvalidateClassBinding(TypeScriptGeneratedClass);
             TypeScriptGeneratedClass->DynamicInvoker = TsDynamicInvoker;
             TypeScriptGeneratedClass->ClassConstructor = &UTypeScriptGeneratedClass::StaticConstructor;
             if (IsInGameThread())
@@ -1612,6 +1640,12 @@ void FJsEnvImpl::TryBindJs(const class UObjectBase* InObject)
                 }
             }
         }
+        else if (IsInGameThread() && Class != UTypeScriptGeneratedClass::StaticClass() && ClassIndex < ClassSkipBindBits.Num())
+        {
+            // the class of a class never changes, so neither does the answer. Tracking the class clears the bit once it's deleted
+            ClassSkipBindBits[ClassIndex] = true;
+            ObjectMap.MarkTracked(Class);
+        }
     }
 }
 
@@ -1757,7 +1791,7 @@ void FJsEnvImpl::Bind(FClassWrapper* ClassWrapper, UObject* UEObject,
 void FJsEnvImpl::SetJsTakeRef(UObject* UEObject, FClassWrapper* ClassWrapper)
 {
     UserObjectRetainer.Retain(UEObject);
-    ObjectMap[UEObject].SetWeak<UClass>(
+    ObjectMap.FindChecked(UEObject).SetWeak<UClass>(
         Cast<UClass>(ClassWrapper->Struct.Get()), FClassWrapper::OnGarbageCollected, v8::WeakCallbackType::kInternalFields);
 }
 
@@ -1871,6 +1905,7 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddDelegate(v8::Isolate* Isolate, v8::Loc
             else
             {
                 ClearDelegate(Isolate, Context, DelegatePtr);
+                EraseDelegate(Iter);
             }
         }
     }
@@ -1910,7 +1945,12 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddDelegate(v8::Isolate* Isolate, v8::Loc
         }
         DelegateMap[DelegatePtr] = {v8::UniquePersistent<v8::Object>(Isolate, JSObject), TWeakObjectPtr<UObject>(Owner),
             DelegateProperty, MulticastDelegateProperty, Function, PassByPointer, nullptr,
-            v8::UniquePersistent<v8::Array>(Isolate, v8::Array::New(Isolate))};
+            v8::UniquePersistent<v8::Array>(Isolate, v8::Array::New(Isolate)), Owner};
+        if (Owner)
+        {
+            DelegatesByOwner.FindOrAdd(Owner).Add(DelegatePtr);
+            ObjectMap.MarkTracked(Owner);
+        }
         return JSObject;
     }
 }
@@ -1939,6 +1979,7 @@ void FJsEnvImpl::InvokeDelegateCallback(UDynamicDelegateProxy* Proxy, void* Para
             return;
         }
         JsCallbackPrototypeMap[SignatureFunction.Get()] = std::make_unique<FFunctionTranslator>(SignatureFunction.Get(), true);
+        ObjectMap.MarkTracked(SignatureFunction.Get());
         Iter = JsCallbackPrototypeMap.find(SignatureFunction.Get());
     }
     else
@@ -2103,6 +2144,19 @@ void FJsEnvImpl::TsConstruct(UTypeScriptGeneratedClass* Class, UObject* Object)
 
 void FJsEnvImpl::NotifyUObjectDeleted(const class UObjectBase* ObjectBase, int32 Index)
 {
+    // most deleted objects never reached js nor got any per-object data in this env
+    if (!ObjectMap.IsTracked(Index))
+    {
+        return;
+    }
+    ObjectMap.ClearTracked(Index);
+#if !defined(ENGINE_INDEPENDENT_JSENV)
+    if (Index < ClassSkipBindBits.Num())
+    {
+        ClassSkipBindBits[Index] = false;
+    }
+#endif
+
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
@@ -2124,6 +2178,9 @@ void FJsEnvImpl::NotifyUObjectDeleted(const class UObjectBase* ObjectBase, int32
     MixinFunctionMap.Remove((UFunction*) ObjectBase);
     ContainerMeta.NotifyElementTypeDeleted((UField*) ObjectBase);
 
+    JsCallbackPrototypeMap.erase((UFunction*) ObjectBase);
+    ReleaseOwnerDelegates(ObjectBase);
+
     auto CallbacksPtr = AutoReleaseCallbacksMap.Find((UObject*) ObjectBase);
     if (CallbacksPtr)
     {
@@ -2181,6 +2238,31 @@ static void SkipFunction(FFrame& Stack, RESULT_DECL, UFunction* Function)
 }
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
+// a ts override or a mixin called back from js (blueprint code reached through a reflected call) already runs inside the
+// isolate and the default context, entering them again for every call is skipped then
+FORCEINLINE static void EnterIsolateIfNeeded(v8::Isolate* Isolate, TOptional<v8::Isolate::Scope>& OutScope)
+{
+#if !defined(WITH_QUICKJS)
+    if (v8::Isolate::GetCurrent() == Isolate)
+    {
+        return;
+    }
+#endif
+    OutScope.Emplace(Isolate);
+}
+
+FORCEINLINE static void EnterContextIfNeeded(
+    v8::Isolate* Isolate, v8::Local<v8::Context> Context, TOptional<v8::Context::Scope>& OutScope)
+{
+#if !defined(WITH_QUICKJS)
+    if (Isolate->InContext() && Isolate->GetCurrentContext() == Context)
+    {
+        return;
+    }
+#endif
+    OutScope.Emplace(Context);
+}
+
 void FJsEnvImpl::InvokeJsMethod(UObject* ContextObject, UJSGeneratedFunction* Function, FFrame& Stack, void* RESULT_PARAM)
 {
 #ifdef SINGLE_THREAD_VERIFY
@@ -2231,10 +2313,12 @@ void FJsEnvImpl::InvokeMixinMethod(UObject* ContextObject, UJSGeneratedFunction*
 #ifdef THREAD_SAFE
     v8::Locker Locker(Isolate);
 #endif
-    v8::Isolate::Scope IsolateScope(Isolate);
+    TOptional<v8::Isolate::Scope> IsolateScope;
+    EnterIsolateIfNeeded(Isolate, IsolateScope);
     v8::HandleScope HandleScope(Isolate);
     auto Context = DefaultContext.Get(Isolate);
-    v8::Context::Scope ContextScope(Context);
+    TOptional<v8::Context::Scope> ContextScope;
+    EnterContextIfNeeded(Isolate, Context, ContextScope);
 
     v8::Local<v8::Value> Self = FindOrAdd(Isolate, Context, ContextObject->GetClass(), ContextObject);
 
@@ -2297,10 +2381,12 @@ void FJsEnvImpl::InvokeTsMethod(UObject* ContextObject, UFunction* Function, FFr
 
     {
         auto Isolate = MainIsolate;
-        v8::Isolate::Scope IsolateScope(Isolate);
+        TOptional<v8::Isolate::Scope> IsolateScope;
+        EnterIsolateIfNeeded(Isolate, IsolateScope);
         v8::HandleScope HandleScope(Isolate);
         auto Context = DefaultContext.Get(Isolate);
-        v8::Context::Scope ContextScope(Context);
+        TOptional<v8::Context::Scope> ContextScope;
+        EnterContextIfNeeded(Isolate, Context, ContextScope);
 
         v8::Local<v8::Value> ThisObj = v8::Undefined(Isolate);
 
@@ -2381,6 +2467,7 @@ void FJsEnvImpl::ExecuteDelegate(
     if (JsCallbackPrototypeMap.find(SignatureFunction) == JsCallbackPrototypeMap.end())
     {
         JsCallbackPrototypeMap[SignatureFunction] = std::make_unique<FFunctionTranslator>(SignatureFunction, true);
+        ObjectMap.MarkTracked(SignatureFunction);
     }
 
     if (Iter->second.DelegateProperty)
@@ -2412,11 +2499,7 @@ bool FJsEnvImpl::AddToDelegate(
     {
         Logger->Warn("try to bind a delegate with invalid owner!");
         ClearDelegate(Isolate, Context, DelegatePtr);
-        if (!Iter->second.PassByPointer)
-        {
-            delete ((FScriptDelegate*) Iter->first);
-        }
-        DelegateMap.erase(Iter);
+        EraseDelegate(Iter);
         return false;
     }
 
@@ -2549,6 +2632,7 @@ FScriptDelegate FJsEnvImpl::NewDelegate(v8::Isolate* Isolate, v8::Local<v8::Cont
     if (Owner)
     {
         TArray<TWeakObjectPtr<UDynamicDelegateProxy>>& Callbacks = AutoReleaseCallbacksMap.FindOrAdd(Owner);
+        ObjectMap.MarkTracked(Owner);
 
         DelegateProxy = NewObject<UDynamicDelegateProxy>();
 #ifdef THREAD_SAFE
@@ -2652,11 +2736,7 @@ bool FJsEnvImpl::RemoveFromDelegate(
     {
         Logger->Warn("try to unbind a delegate with invalid owner!");
         ClearDelegate(Isolate, Context, DelegatePtr);
-        if (!Iter->second.PassByPointer)
-        {
-            delete ((FScriptDelegate*) Iter->first);
-        }
-        DelegateMap.erase(Iter);
+        EraseDelegate(Iter);
         return false;
     }
 
@@ -2747,58 +2827,121 @@ bool FJsEnvImpl::ClearDelegate(v8::Isolate* Isolate, v8::Local<v8::Context>& Con
     return true;
 }
 
+void FJsEnvImpl::EraseDelegate(FDelegateMap::iterator Iter)
+{
+    if (!Iter->second.PassByPointer)
+    {
+        delete ((FScriptDelegate*) Iter->first);
+    }
+    if (auto DelegatePtrs = DelegatesByOwner.Find(Iter->second.OwnerKey))
+    {
+        DelegatePtrs->RemoveSingleSwap(Iter->first);
+        if (DelegatePtrs->Num() == 0)
+        {
+            DelegatesByOwner.Remove(Iter->second.OwnerKey);
+        }
+    }
+    DelegateMap.erase(Iter);
+}
+
+void FJsEnvImpl::ReleaseOwnerDelegates(const UObjectBase* Owner)
+{
+    TArray<void*, TInlineAllocator<2>> DelegatePtrs;
+    if (!DelegatesByOwner.RemoveAndCopyValue(Owner, DelegatePtrs))
+    {
+        return;
+    }
+
+    auto Isolate = MainIsolate;
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
+    v8::Context::Scope ContextScope(Context);
+    for (void* DelegatePtr : DelegatePtrs)
+    {
+        auto Iter = DelegateMap.find(DelegatePtr);
+        if (Iter == DelegateMap.end())
+        {
+            continue;
+        }
+
+        // the owner is half destroyed, only the js side and the proxy are released, the delegate itself must not be touched
+        auto JSObject = Iter->second.JSObject.Get(Isolate);
+        v8::Local<v8::Map>::Cast(JSObject->Get(Context, 0).ToLocalChecked())->Clear();
+        if (Iter->second.Proxy.IsValid())
+        {
+            Iter->second.Proxy->JsFunction.Reset();
+            SysObjectRetainer.Release(Iter->second.Proxy.Get());
+        }
+        if (!Iter->second.PassByPointer)
+        {
+            delete ((FScriptDelegate*) Iter->first);
+        }
+        DelegateMap.erase(Iter);
+    }
+}
+
 bool FJsEnvImpl::CheckDelegateProxies(float Tick)
 {
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
 #endif
-    auto Isolate = MainIsolate;
-#ifdef THREAD_SAFE
-    v8::Locker Locker(Isolate);
-#endif
+    // owners are reclaimed from the delete notification, this only catches leftovers, a few entries per frame
+    static constexpr int32 SweepBudget = 256;
+    // generations start no more often than the old once a second check, only the sweep of one is spread over frames
+    static constexpr float SweepInterval = 1.0f;
 
-    std::vector<void*> PendingToRemove;
-    for (auto& KV : DelegateMap)
+    if (DelegateSweepCursor >= DelegateSweepQueue.Num())
     {
-        if (!KV.second.Owner.IsValid())
+        DelegateSweepIdleTime += Tick;
+        if (DelegateSweepIdleTime < SweepInterval)
         {
-            PendingToRemove.push_back(KV.first);
+            return true;
         }
-    }
+        DelegateSweepIdleTime = 0;
 
-    if (PendingToRemove.size() > 0)
-    {
-        v8::Isolate::Scope IsolateScope(Isolate);
-        v8::HandleScope HandleScope(Isolate);
-        v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
-        v8::Context::Scope ContextScope(Context);
-        for (int i = 0; i < PendingToRemove.size(); ++i)
+        // start a new generation
+        DelegateSweepQueue.Reset(DelegateMap.size());
+        for (auto& KV : DelegateMap)
         {
-            ClearDelegate(Isolate, Context, PendingToRemove[i]);
-            if (!DelegateMap[PendingToRemove[i]].PassByPointer)
-            {
-                delete ((FScriptDelegate*) PendingToRemove[i]);
-            }
-            DelegateMap.erase(PendingToRemove[i]);
+            DelegateSweepQueue.Add(KV.first);
         }
-    }
+        DelegateSweepCursor = 0;
 
-    // Collecting invalid function translators to remove.
-    std::vector<UFunction*> PendingToRemoveJsCallbacks;
-    for (auto& KV : JsCallbackPrototypeMap)
-    {
-        if ((nullptr == KV.first) || (!KV.second->IsValid()))
+        // Collecting invalid function translators to remove.
+        for (auto Iter = JsCallbackPrototypeMap.begin(); Iter != JsCallbackPrototypeMap.end();)
         {
-            PendingToRemoveJsCallbacks.push_back(KV.first);
+            if ((nullptr == Iter->first) || (!Iter->second->IsValid()))
+            {
+                Iter = JsCallbackPrototypeMap.erase(Iter);
+            }
+            else
+            {
+                ++Iter;
+            }
         }
     }
 
-    if (PendingToRemoveJsCallbacks.size() > 0)
+    auto Isolate = MainIsolate;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(Isolate);
+#endif
+
+    const int32 SweepEnd = FMath::Min(DelegateSweepCursor + SweepBudget, DelegateSweepQueue.Num());
+    for (; DelegateSweepCursor < SweepEnd; ++DelegateSweepCursor)
     {
-        for (int32 i = 0; i < PendingToRemoveJsCallbacks.size(); i++)
+        auto Iter = DelegateMap.find(DelegateSweepQueue[DelegateSweepCursor]);
+        if (Iter == DelegateMap.end() || Iter->second.Owner.IsValid())
         {
-            JsCallbackPrototypeMap.erase(PendingToRemoveJsCallbacks[i]);
+            continue;
         }
+
+        v8::Isolate::Scope IsolateScope(Isolate);
+        v8::HandleScope HandleScope(Isolate);
+        v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
+        v8::Context::Scope ContextScope(Context);
+        ClearDelegate(Isolate, Context, Iter->first);
+        EraseDelegate(Iter);
     }
 
     return true;
@@ -2842,9 +2985,23 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddContainer(
         PassByPointer ? FScriptArrayWrapper::OnGarbageCollected : FScriptArrayWrapper::OnGarbageCollectedWithFree, PassByPointer,
         EArray);
     DataTransfer::SetPointer(Isolate, Result, GetContainerPropertyTranslator(Property), 1);
+    if (!PassByPointer)
+    {
+        FScriptArrayWrapper::MarkOwnedByJs(Isolate, Result);
+    }
     return Result;
 }
 
+void FJsEnvImpl::InvalidateArrayView(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, FScriptArray* Ptr)
+{
+    // only arrays owned by js have views
+    auto CacheItem = ContainerCache.Find(Ptr);
+    if (CacheItem && CacheItem->Type == EArray && CacheItem->NeedRelease)
+    {
+        FScriptArrayWrapper::InvalidateTypedArrayView(Isolate, Context, CacheItem->Container.Get(Isolate).As<v8::Object>());
+    }
+}
+
 v8::Local<v8::Value> FJsEnvImpl::FindOrAddContainer(
     v8::Isolate* Isolate, v8::Local<v8::Context>& Context, PropertyMacro* Property, FScriptSet* Ptr, bool PassByPointer)
 {
@@ -2910,7 +3067,7 @@ void FJsEnvImpl::BindStruct(
                 {
                     // TFScriptStructWrapper存放在TypeReflectionMap中，Isolate先Dispose后，对象才跟着销毁
                     FScriptStructWrapper* StructInfo = static_cast<FScriptStructWrapper*>(DeleterData);
-                    FScriptStructWrapper::Free(StructInfo->Struct, StructInfo->ExternalFinalize, Data);
+                    StructInfo->Free(Data);
                 },
                 ScriptStructWrapper);
             __USE(JSObject->Set(MainIsolate->GetCurrentContext(), 0, MemoryHolder));
@@ -2922,7 +3079,7 @@ void FJsEnvImpl::BindStruct(
                 {
                     // TFScriptStructWrapper存放在TypeReflectionMap中，Isolate先Dispose后，对象才跟着销毁
                     FScriptStructWrapper* StructInfo = static_cast<FScriptStructWrapper*>(DeleterData);
-                    FScriptStructWrapper::Free(StructInfo->Struct, StructInfo->ExternalFinalize, Data);
+                    StructInfo->Free(Data);
                 },
                 ScriptStructWrapper);
             auto MemoryHolder = v8::ArrayBuffer::New(MainIsolate, std::move(Backing));
@@ -3023,6 +3180,7 @@ std::shared_ptr<FStructWrapper> FJsEnvImpl::GetStructWrapper(UStruct* InStruct,
     if (!TypeReflectionPtr)
     {
         auto Ret = std::make_shared<FStructWrapper>(InStruct);
+        Ret->MemoryPool = &StructMemoryPool;
         TypeReflectionMap.Add(FullName, Ret);
         // UE_LOG(LogTemp, Warning, TEXT("FJsEnvImpl::GetStructWrapper new %s // %s"), *InStruct->GetName(), *FullName);
         return Ret;
@@ -3129,6 +3287,7 @@ FJsEnvImpl::FTemplateInfo* FJsEnvImpl::GetTemplateInfoOfType(UStruct* InStruct,
         }
 
         Existed = false;
+        ObjectMap.MarkTracked(InStruct);
         return &TypeToTemplateInfoMap.Add(InStruct, {v8::UniquePersistent<v8::FunctionTemplate>(Isolate, Template), StructWrapper});
     }
     else
@@ -3416,6 +3575,7 @@ bool FJsEnvImpl::GetContainerTypeProperty(v8::Local<v8::Context> Context, v8::Lo
     else if (auto Field = Cast<UField>(FV8Utils::GetUObject(Context, Value)))
     {
         *PropertyPtr = ContainerMeta.GetObjectProperty(Field);
+        ObjectMap.MarkTracked(Field);
         return *PropertyPtr != nullptr;
     }
     else
@@ -4135,19 +4295,34 @@ void FJsEnvImpl::SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& I
     FTimerInfo& TimerInfo = TimerInfos.Emplace(DelegateHandleId, FTimerInfo());
     TimerInfo.Callback.Reset(Isolate, v8::Local<v8::Function>::Cast(Info[0]));
 
-    float Millisecond = Info[1]->NumberValue(Context).ToChecked();
-    float Delay = Millisecond / 1000.f;
-
-    TimerInfo.TickerHandle =
-        FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, DelegateHandleId, Continue](float)
-                                                 { return this->TimerCallback(DelegateHandleId, Continue); }),
-            Delay);
+    double Millisecond = Info[1]->NumberValue(Context).ToChecked();
+    TimerInfo.IntervalMs = FMath::IsFinite(Millisecond) ? (int64) FMath::Clamp(Millisecond, 0.0, 1e15) : 0;
+    TimerInfo.Continue = Continue;
+    TimerInfo.WheelHandle = TimerWheel.Schedule(DelegateHandleId, TimerInfo.IntervalMs);
 
     Info.GetReturnValue().Set(DelegateHandleId);
 }
 
-bool FJsEnvImpl::TimerCallback(int DelegateHandleId, bool Continue)
+bool FJsEnvImpl::TickTimers(float DeltaTime)
 {
+    TimerPendingMs += DeltaTime * 1000.0;
+    int64 ElapsedMs = (int64) TimerPendingMs;
+    TimerPendingMs -= ElapsedMs;
+    if (ElapsedMs == 0 && TimerWheel.IsNextTickDue())
+    {
+        // a frame shorter than a tick still runs what is due on the next one, or setTimeout(f, 0) would wait for frames
+        // to add up to a millisecond, the fraction is dropped rather than owed so the following frames aren't held back
+        ElapsedMs = 1;
+        TimerPendingMs = 0;
+    }
+
+    ExpiredTimers.Reset();
+    TimerWheel.Advance(ElapsedMs, ExpiredTimers);
+    if (ExpiredTimers.Num() == 0)
+    {
+        return true;
+    }
+
     v8::Isolate* Isolate = MainIsolate;
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
@@ -4156,48 +4331,66 @@ bool FJsEnvImpl::TimerCallback(int DelegateHandleId, bool Continue)
     v8::Locker Locker(MainIsolate);
 #endif
 
+    // every timer that expired this frame runs under the same scopes, in the order the wheel gave them
     v8::Isolate::Scope Isolatescope(Isolate);
     v8::HandleScope HandleScope(Isolate);
     v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
     v8::Context::Scope ContextScope(Context);
+    v8::TryCatch TryCatch(Isolate);
 
-    FTimerInfo* PTimeInfo = TimerInfos.Find(DelegateHandleId);
-    if (!PTimeInfo)
+    // the nodes of expired timers are already back in the wheel's pool, drop their handles before any callback can reuse them
+    for (uint32_t DelegateHandleId : ExpiredTimers)
     {
-        Logger->Warn(FString::Printf(TEXT("Try to callback a invalid timer: %d"), DelegateHandleId));
-        return false;
+        if (FTimerInfo* PTimeInfo = TimerInfos.Find(DelegateHandleId))
+        {
+            PTimeInfo->WheelHandle = INDEX_NONE;
+        }
     }
 
-    auto OriginHandle = PTimeInfo->TickerHandle;
-    v8::Local<v8::Function> Function = TimerInfos[DelegateHandleId].Callback.Get(Isolate);
-
-    v8::TryCatch TryCatch(Isolate);
-    (void) (Function->Call(Context, Context->Global(), 0, nullptr));
-
-    if (TryCatch.HasCaught())
+    for (int32 i = 0; i < ExpiredTimers.Num(); ++i)
     {
-        FString Message =
-            FString::Printf(TEXT("Exception in Timer Callback: %s"), *(FV8Utils::TryCatchToString(Isolate, &TryCatch)));
-        Logger->Error(Message);
-    }
+        const uint32_t DelegateHandleId = ExpiredTimers[i];
+        FTimerInfo* PTimeInfo = TimerInfos.Find(DelegateHandleId);
+        if (!PTimeInfo)
+        {
+            // cleared by a callback that ran earlier in this batch
+            continue;
+        }
+
+        v8::Local<v8::Function> Function = PTimeInfo->Callback.Get(Isolate);
+        if (PTimeInfo->Continue)
+        {
+            // rescheduled before the call, so a clearInterval from the callback cancels the next run
+            PTimeInfo->WheelHandle = TimerWheel.Schedule(DelegateHandleId, PTimeInfo->IntervalMs);
+        }
+        else
+        {
+            PTimeInfo->Callback.Reset();
+            TimerInfos.Remove(DelegateHandleId);
+        }
 
-    auto ClearInCallback = !TimerInfos.Contains(DelegateHandleId) || (OriginHandle != TimerInfos[DelegateHandleId].TickerHandle);
+        (void) (Function->Call(Context, Context->Global(), 0, nullptr));
 
-    if (!Continue && !ClearInCallback)
-    {
-        RemoveFTickerDelegateHandle(DelegateHandleId);
+        if (TryCatch.HasCaught())
+        {
+            FString Message =
+                FString::Printf(TEXT("Exception in Timer Callback: %s"), *(FV8Utils::TryCatchToString(Isolate, &TryCatch)));
+            Logger->Error(Message);
+            TryCatch.Reset();
+        }
     }
 
-    return Continue && !ClearInCallback;
+    return true;
 }
 
 void FJsEnvImpl::RemoveFTickerDelegateHandle(int DelegateHandleId)
 {
-    if (!TimerInfos.Contains(DelegateHandleId))
+    FTimerInfo* PTimeInfo = TimerInfos.Find(DelegateHandleId);
+    if (!PTimeInfo)
     {
         return;
     }
-    FUETicker::GetCoreTicker().RemoveTicker(TimerInfos[DelegateHandleId].TickerHandle);
+    TimerWheel.Cancel(PTimeInfo->WheelHandle, DelegateHandleId);
     TimerInfos.Remove(DelegateHandleId);
 }
 
@@ -4319,6 +4512,7 @@ void FJsEnvImpl::MakeUClass(const v8::FunctionCallbackInfo<v8::Value>& Info)
     if (!GeneratedClasses.Contains(Class))
     {
         GeneratedClasses.Add(Class);
+        ObjectMap.MarkTracked(Class);
     }
     SysObjectRetainer.Retain(Class);
 
@@ -4402,6 +4596,9 @@ void FJsEnvImpl::Mixin(const v8::FunctionCallbackInfo<v8::Value>& Info)
         New->SetSuperStruct(To);
     }
 
+    InvalidateClassBinding(To);
+    InvalidateClassBinding(New);
+
     auto Keys = MixinMethods->GetOwnPropertyNames(Context).ToLocalChecked();
     TArray<FName> ReplaceMethodNames;
     for (decltype(Keys->Length()) i = 0; i < Keys->Length(); ++i)
@@ -4413,8 +4610,9 @@ void FJsEnvImpl::Mixin(const v8::FunctionCallbackInfo<v8::Value>& Info)
         {
             auto JsFunc = MixinMethods->Get(Context, Key).ToLocalChecked();
             auto MixinedFunc = UJSGeneratedClass::Mixin(Isolate, New, Function, MixinInvoker, TakeJsObjectRef, !NoWarning);
-            MixinFunctionMap.Emplace(
+            MixinFunctionMap.Add(
                 MixinedFunc, v8::UniquePersistent<v8::Function>(Isolate, v8::Local<v8::Function>::Cast(JsFunc)));
+            ObjectMap.MarkTracked(MixinedFunc);
             ReplaceMethodNames.Add(MethodName);
         }
     }
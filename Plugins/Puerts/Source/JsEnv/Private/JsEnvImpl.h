@@ -14,6 +14,10 @@
 #include "CppObjectMapper.h"
 #include "V8Utils.h"
 #include "ObjectMapper.h"
+#include "ObjectWrapperTable.h"
+#include "FunctionSlotTable.h"
+#include "JsTimerWheel.h"
+#include "NameStringCache.h"
 #include "JSLogger.h"
 #include "ObjectRetainer.h"
 #if !defined(ENGINE_INDEPENDENT_JSENV)
@@ -192,6 +196,8 @@ public:
     virtual v8::Local<v8::Value> FindOrAddContainer(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, PropertyMacro* Property,
         FScriptArray* Ptr, bool PassByPointer) override;
 
+    virtual void InvalidateArrayView(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, FScriptArray* Ptr) override;
+
     virtual v8::Local<v8::Value> FindOrAddContainer(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, PropertyMacro* Property,
         FScriptSet* Ptr, bool PassByPointer) override;
 
@@ -230,6 +236,21 @@ public:
 
     bool CheckDelegateProxies(float Tick);
 
+    virtual v8::Local<v8::String> NameToJs(v8::Isolate* Isolate, const FName& Name) override
+    {
+        return NameStringCache.ToJs(Isolate, Name);
+    }
+
+    virtual FName JsToName(v8::Isolate* Isolate, v8::Local<v8::Value> Value) override
+    {
+        return NameStringCache.ToName(Isolate, Value);
+    }
+
+    virtual FStructMemoryPool* GetStructMemoryPool() override
+    {
+        return &StructMemoryPool;
+    }
+
     virtual v8::Local<v8::Value> CreateArray(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, FPropertyTranslator* Property, void* ArrayPtr) override;
 
@@ -316,7 +337,7 @@ private:
 
     void SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Continue);
 
-    bool TimerCallback(int DelegateHandleId, bool Continue);
+    bool TickTimers(float DeltaTime);
 
     void RemoveFTickerDelegateHandle(int HandleId);
 
@@ -334,6 +355,21 @@ private:
     void MakeUClass(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     TArray<TWeakObjectPtr<UClass>> MixinClasses;
+
+#if !defined(ENGINE_INDEPENDENT_JSENV)
+    // one bit per class index, set once a class is known to never need TryBindJs for its instances.
+    // sized to the capacity of the object array up front, so the creation hook can test it from any thread without locking
+    TBitArray<> ClassSkipBindBits;
+
+    FORCEINLINE void InvalidateClassBinding(const UClass* Class)
+    {
+        const int32 ClassIndex = GUObjectArray.ObjectToIndex(Class);
+        if (ClassIndex >= 0 && ClassIndex < ClassSkipBindBits.Num())
+        {
+            ClassSkipBindBits[ClassIndex] = false;
+        }
+    }
+#endif
     void Mixin(const v8::FunctionCallbackInfo<v8::Value>& Info);
 #endif
 
@@ -571,10 +607,14 @@ private:
 
     TMap<FString, std::shared_ptr<FStructWrapper>> TypeReflectionMap;
 
-    TMap<UObject*, v8::UniquePersistent<v8::Value>> ObjectMap;
+    FObjectWrapperTable ObjectMap;
+
+    FNameStringCache NameStringCache;
 
     TMap<void*, FObjectCacheNode> StructCache;
 
+    FStructMemoryPool StructMemoryPool;
+
     struct ContainerCacheItem
     {
         v8::UniquePersistent<v8::Value> Container;
@@ -620,6 +660,7 @@ private:
         bool PassByPointer;
         TWeakObjectPtr<UDynamicDelegateProxy> Proxy;
         v8::UniquePersistent<v8::Array> JsCallbacks;
+        const UObjectBase* OwnerKey;    // raw owner, only used to find the entry in DelegatesByOwner once the owner is gone
     };
 
     struct TsFunctionInfo
@@ -690,11 +731,28 @@ private:
 
     v8::UniquePersistent<v8::FunctionTemplate> SoftObjectPtrTemplate;
 
-    std::map<void*, DelegateObjectInfo> DelegateMap;
+    typedef std::unordered_map<void*, DelegateObjectInfo> FDelegateMap;
+
+    FDelegateMap DelegateMap;
+
+    // delegates bound from js grouped by owner, so they are reclaimed as soon as the owner is deleted
+    TMap<const UObjectBase*, TArray<void*, TInlineAllocator<2>>> DelegatesByOwner;
+
+    // incremental safety net for whatever the delete notification missed, a generation is a snapshot of the map keys
+    TArray<void*> DelegateSweepQueue;
+
+    int32 DelegateSweepCursor = 0;
 
-    TMap<UFunction*, TsFunctionInfo> TsFunctionMap;
+    float DelegateSweepIdleTime = 0;
 
-    TMap<UFunction*, v8::UniquePersistent<v8::Function>> MixinFunctionMap;
+    void EraseDelegate(FDelegateMap::iterator Iter);
+
+    void ReleaseOwnerDelegates(const UObjectBase* Owner);
+
+    // looked up on every call from blueprint to a ts override or a mixin, by function index instead of hashing the pointer
+    TFunctionSlotTable<TsFunctionInfo> TsFunctionMap;
+
+    TFunctionSlotTable<v8::UniquePersistent<v8::Function>> MixinFunctionMap;
 
     std::map<UStruct*, std::vector<UFunction*>> ExtensionMethodsMap;
 
@@ -703,11 +761,22 @@ private:
     struct FTimerInfo
     {
         v8::Global<v8::Function> Callback;
-        FUETickDelegateHandle TickerHandle;
+        int32 WheelHandle;
+        int64 IntervalMs;
+        bool Continue;
     };
     uint32_t TimerID = 0;
     TMap<uint32_t, FTimerInfo> TimerInfos;
 
+    // every js timer of the env lives in this wheel, driven by a single ticker
+    FJsTimerWheel TimerWheel;
+
+    FUETickDelegateHandle TimerTickerHandle;
+
+    double TimerPendingMs = 0;
+
+    TArray<uint32_t> ExpiredTimers;
+
     FUETickDelegateHandle DelegateProxiesCheckerHandler;
 
     V8Inspector* Inspector;
@@ -0,0 +1,266 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NamespaceDef.h"
+
+namespace PUERTS_NAMESPACE
+{
+// hierarchical timing wheel with a resolution of one tick (a millisecond for js timers).
+// 4 levels of 256 slots cover 2^32 ticks, farther timers wait in the last level and get placed again when it cascades.
+// nodes live in a pooled array linked into their slot, so scheduling and cancelling are O(1) and don't allocate once warm.
+// expired timers come out ordered by due tick, then by the order they were scheduled, whatever path they took through the levels.
+class FJsTimerWheel
+{
+public:
+    FJsTimerWheel() : CurrentTick(0), NextSequence(0), FreeList(INDEX_NONE), NumScheduled(0)
+    {
+        for (int32 Level = 0; Level < NumLevels; ++Level)
+        {
+            for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+            {
+                Heads[Level][Slot] = INDEX_NONE;
+            }
+        }
+    }
+
+    FJsTimerWheel(const FJsTimerWheel&) = delete;
+    FJsTimerWheel& operator=(const FJsTimerWheel&) = delete;
+
+    // returns a handle for Cancel, it stays valid until the timer expires or gets cancelled, after that the node can be
+    // recycled by another timer, so Cancel also takes the id the handle was scheduled for.
+    // a timer never expires in the same Advance it was scheduled from, even with a delay of 0
+    int32 Schedule(uint32 TimerId, int64 DelayTicks)
+    {
+        int32 NodeIndex = FreeList;
+        if (NodeIndex != INDEX_NONE)
+        {
+            FreeList = Nodes[NodeIndex].Next;
+        }
+        else
+        {
+            NodeIndex = Nodes.AddUninitialized();
+        }
+
+        FNode& Node = Nodes[NodeIndex];
+        Node.Due = CurrentTick + FMath::Max<int64>(DelayTicks, 1);
+        Node.Sequence = NextSequence++;
+        Node.TimerId = TimerId;
+        Link(NodeIndex);
+        ++NumScheduled;
+        return NodeIndex;
+    }
+
+    void Cancel(int32 Handle, uint32 TimerId)
+    {
+        if (Nodes.IsValidIndex(Handle) && Nodes[Handle].Level != INDEX_NONE && Nodes[Handle].TimerId == TimerId)
+        {
+            Unlink(Handle);
+            Free(Handle);
+        }
+    }
+
+    // moves the wheel forward, appending the id of every timer that expired on the way to OutExpired
+    void Advance(int64 ElapsedTicks, TArray<uint32>& OutExpired)
+    {
+        const int64 TargetTick = CurrentTick + ElapsedTicks;
+        if (NumScheduled == 0)
+        {
+            CurrentTick = TargetTick;
+            return;
+        }
+
+        Expired.Reset();
+        while (CurrentTick < TargetTick && NumScheduled > Expired.Num())
+        {
+            ++CurrentTick;
+            const int32 Slot = CurrentTick & SlotMask;
+            if (Slot == 0)
+            {
+                Cascade(1);
+            }
+
+            int32 NodeIndex = Heads[0][Slot];
+            Heads[0][Slot] = INDEX_NONE;
+            while (NodeIndex != INDEX_NONE)
+            {
+                const int32 Next = Nodes[NodeIndex].Next;
+                Expired.Add(NodeIndex);
+                Nodes[NodeIndex].Level = INDEX_NONE;
+                NodeIndex = Next;
+            }
+        }
+        CurrentTick = TargetTick;
+
+        Expired.Sort(
+            [this](int32 A, int32 B)
+            { return Nodes[A].Due != Nodes[B].Due ? Nodes[A].Due < Nodes[B].Due : Nodes[A].Sequence < Nodes[B].Sequence; });
+
+        for (int32 NodeIndex : Expired)
+        {
+            OutExpired.Add(Nodes[NodeIndex].TimerId);
+            Free(NodeIndex);
+        }
+    }
+
+    // whether advancing a single tick would expire something, timers due when level 0 wraps still sit in a higher level
+    // so that tick is reported as due whenever anything is scheduled
+    bool IsNextTickDue() const
+    {
+        const int32 Slot = (CurrentTick + 1) & SlotMask;
+        return NumScheduled > 0 && (Slot == 0 || Heads[0][Slot] != INDEX_NONE);
+    }
+
+    int32 Num() const
+    {
+        return NumScheduled;
+    }
+
+    void Empty()
+    {
+        Nodes.Empty();
+        FreeList = INDEX_NONE;
+        NumScheduled = 0;
+        for (int32 Level = 0; Level < NumLevels; ++Level)
+        {
+            for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+            {
+                Heads[Level][Slot] = INDEX_NONE;
+            }
+        }
+    }
+
+private:
+    static constexpr int32 NumLevels = 4;
+    static constexpr int32 SlotBits = 8;
+    static constexpr int32 NumSlots = 1 << SlotBits;
+    static constexpr int64 SlotMask = NumSlots - 1;
+    static constexpr int64 MaxDelta = (int64(1) << (SlotBits * NumLevels)) - 1;
+
+    struct FNode
+    {
+        int64 Due;
+        uint64 Sequence;
+        uint32 TimerId;
+        int32 Prev;
+        int32 Next;
+        int32 Level;    // INDEX_NONE while not linked
+        int32 Slot;
+    };
+
+    void Link(int32 NodeIndex)
+    {
+        FNode& Node = Nodes[NodeIndex];
+        // farther than the wheel reaches, park it in the last slot it can see and place it again once that slot cascades
+        const int64 Due = CurrentTick + FMath::Min(Node.Due - CurrentTick, MaxDelta);
+        const int64 Delta = Due - CurrentTick;
+
+        int32 Level = 0;
+        while (Level < NumLevels - 1 && Delta >= (int64(1) << (SlotBits * (Level + 1))))
+        {
+            ++Level;
+        }
+        const int32 Slot = (Due >> (SlotBits * Level)) & SlotMask;
+
+        // append, so timers placed directly in a slot keep their scheduling order
+        Node.Level = Level;
+        Node.Slot = Slot;
+        Node.Next = INDEX_NONE;
+        int32& Head = Heads[Level][Slot];
+        if (Head == INDEX_NONE)
+        {
+            Node.Prev = NodeIndex;
+            Head = NodeIndex;
+        }
+        else
+        {
+            // the head keeps the tail in its Prev
+            const int32 Tail = Nodes[Head].Prev;
+            Nodes[Tail].Next = NodeIndex;
+            Node.Prev = Tail;
+            Nodes[Head].Prev = NodeIndex;
+        }
+    }
+
+    void Unlink(int32 NodeIndex)
+    {
+        FNode& Node = Nodes[NodeIndex];
+        int32& Head = Heads[Node.Level][Node.Slot];
+        if (Head == NodeIndex)
+        {
+            Head = Node.Next;
+            if (Head != INDEX_NONE)
+            {
+                Nodes[Head].Prev = Node.Prev;
+            }
+        }
+        else
+        {
+            Nodes[Node.Prev].Next = Node.Next;
+            if (Node.Next != INDEX_NONE)
+            {
+                Nodes[Node.Next].Prev = Node.Prev;
+            }
+            else
+            {
+                Nodes[Head].Prev = Node.Prev;
+            }
+        }
+        Node.Level = INDEX_NONE;
+    }
+
+    void Free(int32 NodeIndex)
+    {
+        Nodes[NodeIndex].Level = INDEX_NONE;
+        Nodes[NodeIndex].Next = FreeList;
+        FreeList = NodeIndex;
+        --NumScheduled;
+    }
+
+    // empties the slot of the given level the current tick just reached into the levels below
+    void Cascade(int32 Level)
+    {
+        if (Level >= NumLevels)
+        {
+            return;
+        }
+
+        const int32 Slot = (CurrentTick >> (SlotBits * Level)) & SlotMask;
+        if (Slot == 0)
+        {
+            Cascade(Level + 1);
+        }
+
+        int32 NodeIndex = Heads[Level][Slot];
+        Heads[Level][Slot] = INDEX_NONE;
+        while (NodeIndex != INDEX_NONE)
+        {
+            // timers due right now land in the level 0 slot that is collected next
+            const int32 Next = Nodes[NodeIndex].Next;
+            Link(NodeIndex);
+            NodeIndex = Next;
+        }
+    }
+
+    int64 CurrentTick;
+
+    uint64 NextSequence;
+
+    TArray<FNode> Nodes;
+
+    int32 FreeList;
+
+    int32 NumScheduled;
+
+    int32 Heads[NumLevels][NumSlots];
+
+    TArray<int32> Expired;
+};
+}    // namespace PUERTS_NAMESPACE
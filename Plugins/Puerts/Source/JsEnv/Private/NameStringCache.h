@@ -0,0 +1,182 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NamespaceDef.h"
+#include "V8Utils.h"
+
+PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
+
+namespace PUERTS_NAMESPACE
+{
+// per isolate FName <-> js string cache, scripts tend to pass the same few names over and over.
+// FName -> internalized string is looked up by name, string -> FName by the string hash v8 already keeps, verified by content.
+// the strings are held weakly so js can still collect them, and the whole cache is dropped once it reaches MaxEntries.
+class FNameStringCache
+{
+public:
+    FNameStringCache() = default;
+
+    FNameStringCache(const FNameStringCache&) = delete;
+    FNameStringCache& operator=(const FNameStringCache&) = delete;
+
+    v8::Local<v8::String> ToJs(v8::Isolate* Isolate, const FName& Name)
+    {
+#if defined(WITH_QUICKJS)
+        return FV8Utils::ToV8String(Isolate, Name);
+#else
+        if (const int32* EntryIndex = NameToEntry.Find(KeyOf(Name)))
+        {
+            FEntry& Entry = Entries[*EntryIndex];
+            if (!Entry.String.IsEmpty())
+            {
+                return Entry.String.Get(Isolate);
+            }
+            // collected by js, cache a new one
+            v8::Local<v8::String> Str = MakeString(Isolate, Name);
+            Refresh(Isolate, *EntryIndex, Str);
+            return Str;
+        }
+
+        v8::Local<v8::String> Str = MakeString(Isolate, Name);
+        Add(Isolate, Name, Str);
+        return Str;
+#endif
+    }
+
+    FName ToName(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
+    {
+#if defined(WITH_QUICKJS)
+        return FV8Utils::ToFName(Isolate, Value);
+#else
+        if (Value.IsEmpty() || !Value->IsString())
+        {
+            return FV8Utils::ToFName(Isolate, Value);
+        }
+
+        v8::Local<v8::String> Str = Value.As<v8::String>();
+        const int32 Hash = Str->GetIdentityHash();
+        if (const int32* EntryIndex = HashToEntry.Find(Hash))
+        {
+            FEntry& Entry = Entries[*EntryIndex];
+            if (!Entry.String.IsEmpty() && Entry.String.Get(Isolate)->StrictEquals(Str))
+            {
+                return Entry.Name;
+            }
+        }
+
+        FName Name = FV8Utils::ToFName(Isolate, Str);
+        if (const int32* EntryIndex = NameToEntry.Find(KeyOf(Name)))
+        {
+            // the cached string was collected by js, the one passed now takes its place so the next lookup hits again
+            if (Entries[*EntryIndex].String.IsEmpty())
+            {
+                Refresh(Isolate, *EntryIndex, Str);
+            }
+        }
+        else
+        {
+            Add(Isolate, Name, Str);
+        }
+        return Name;
+#endif
+    }
+
+    void Empty()
+    {
+#if !defined(WITH_QUICKJS)
+        for (int32 i = 0; i < NumEntries; ++i)
+        {
+            Entries[i].String.Reset();
+        }
+        NumEntries = 0;
+        NameToEntry.Empty();
+        HashToEntry.Empty();
+#endif
+    }
+
+private:
+#if !defined(WITH_QUICKJS)
+    static constexpr int32 MaxEntries = 4096;
+
+    struct FEntry
+    {
+        FName Name;
+        v8::Global<v8::String> String;
+    };
+
+#if WITH_CASE_PRESERVING_NAME
+    // names differing only in case compare equal, key on the display entry so every spelling gets its own string
+    using FNameKey = uint64;
+
+    static FNameKey KeyOf(const FName& Name)
+    {
+        return ((uint64) Name.GetDisplayIndex().ToUnstableInt() << 32) | (uint32) Name.GetNumber();
+    }
+#else
+    using FNameKey = FName;
+
+    static const FName& KeyOf(const FName& Name)
+    {
+        return Name;
+    }
+#endif
+
+    static v8::Local<v8::String> MakeString(v8::Isolate* Isolate, const FName& Name)
+    {
+        const FString String = FV8Utils::NameToFString(Name);
+        return FV8Utils::ToV8String(Isolate, *String, String.Len(), true);
+    }
+
+    void Add(v8::Isolate* Isolate, const FName& Name, v8::Local<v8::String> Str)
+    {
+        if (!Entries)
+        {
+            Entries = MakeUnique<FEntry[]>(MaxEntries);
+        }
+        if (NumEntries >= MaxEntries)
+        {
+            Empty();
+        }
+
+        const int32 EntryIndex = NumEntries++;
+        Entries[EntryIndex].Name = Name;
+        NameToEntry.Add(KeyOf(Name), EntryIndex);
+        Refresh(Isolate, EntryIndex, Str);
+    }
+
+    void Refresh(v8::Isolate* Isolate, int32 EntryIndex, v8::Local<v8::String> Str)
+    {
+        FEntry& Entry = Entries[EntryIndex];
+        Entry.String.Reset(Isolate, Str);
+        Entry.String.SetWeak();
+        // on a hash collision a live string keeps the slot, the other one just takes the slow path
+        int32& HashEntry = HashToEntry.FindOrAdd(Str->GetIdentityHash(), EntryIndex);
+        if (Entries[HashEntry].String.IsEmpty())
+        {
+            HashEntry = EntryIndex;
+        }
+    }
+
+    // a weak global without callback is reset in place by v8, so entries never move once allocated
+    TUniquePtr<FEntry[]> Entries;
+
+    int32 NumEntries = 0;
+
+    TMap<FNameKey, int32> NameToEntry;
+
+    TMap<int32, int32> HashToEntry;
+#endif
+};
+}    // namespace PUERTS_NAMESPACE
@@ -82,6 +82,9 @@ public:
     virtual v8::Local<v8::Value> FindOrAddContainer(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, PropertyMacro* Property, FScriptArray* Ptr, bool PassByPointer) = 0;
 
+    // native code is about to get write access to the array, the typed array view js may have of it has to go
+    virtual void InvalidateArrayView(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, FScriptArray* Ptr) = 0;
+
     virtual v8::Local<v8::Value> FindOrAddContainer(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, PropertyMacro* Property, FScriptSet* Ptr, bool PassByPointer) = 0;
 
@@ -114,6 +117,12 @@ public:
 
     virtual v8::Local<v8::Value> AddSoftObjectPtr(
         v8::Isolate* Isolate, v8::Local<v8::Context> Context, FSoftObjectPtr* SoftObjectPtr, UClass* Class, bool IsSoftClass) = 0;
+
+    virtual v8::Local<v8::String> NameToJs(v8::Isolate* Isolate, const FName& Name) = 0;
+
+    virtual FName JsToName(v8::Isolate* Isolate, v8::Local<v8::Value> Value) = 0;
+
+    virtual FStructMemoryPool* GetStructMemoryPool() = 0;
 };
 #endif
 
@@ -0,0 +1,183 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+#include "Containers/BitArray.h"
+#include "NamespaceDef.h"
+
+PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
+
+namespace PUERTS_NAMESPACE
+{
+// UObject -> js wrapper table, addressed by the GUObjectArray index of the object instead of hashing the pointer.
+// Slots live in pages that are only allocated once an object of that index range reaches js, and a serial number check guards
+// against a stale slot being taken for a new object that reused the index.
+// A second bitset tracks every object the env keeps any per-object data for (wrapper, type template, generated function...),
+// so the delete listener can skip the objects js never saw with a single bit test.
+class FObjectWrapperTable
+{
+public:
+    FObjectWrapperTable() : NumWrappers(0)
+    {
+    }
+
+    FObjectWrapperTable(const FObjectWrapperTable&) = delete;
+    FObjectWrapperTable& operator=(const FObjectWrapperTable&) = delete;
+
+    v8::UniquePersistent<v8::Value>* Find(const UObjectBase* Object)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        if (!HasWrapper(Index))
+        {
+            return nullptr;
+        }
+        FSlot& Slot = GetSlot(Index);
+        return (Slot.Object == Object && Slot.SerialNumber == GUObjectArray.GetSerialNumber(Index)) ? &Slot.Value : nullptr;
+    }
+
+    v8::UniquePersistent<v8::Value>& FindChecked(const UObjectBase* Object)
+    {
+        v8::UniquePersistent<v8::Value>* Value = Find(Object);
+        check(Value);
+        return *Value;
+    }
+
+    v8::UniquePersistent<v8::Value>& Emplace(const UObjectBase* Object, v8::UniquePersistent<v8::Value>&& Value)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        GrowBits(Index);
+        FSlot& Slot = GetOrAllocateSlot(Index);
+        if (!WrapperBits[Index])
+        {
+            ++NumWrappers;
+        }
+        Slot.Object = Object;
+        Slot.SerialNumber = GUObjectArray.AllocateSerialNumber(Index);
+        Slot.Value = std::move(Value);
+        WrapperBits[Index] = true;
+        TrackedBits[Index] = true;
+        return Slot.Value;
+    }
+
+    bool Remove(const UObjectBase* Object)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        if (!HasWrapper(Index))
+        {
+            return false;
+        }
+        FSlot& Slot = GetSlot(Index);
+        if (Slot.Object != Object)
+        {
+            return false;
+        }
+        Slot.Object = nullptr;
+        Slot.SerialNumber = 0;
+        Slot.Value.Reset();
+        WrapperBits[Index] = false;
+        --NumWrappers;
+        return true;
+    }
+
+    // mark an object the env keeps data for, even if it has no wrapper
+    void MarkTracked(const UObjectBase* Object)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(Object);
+        GrowBits(Index);
+        TrackedBits[Index] = true;
+    }
+
+    FORCEINLINE bool IsTracked(int32 Index) const
+    {
+        return Index >= 0 && Index < TrackedBits.Num() && TrackedBits[Index];
+    }
+
+    FORCEINLINE void ClearTracked(int32 Index)
+    {
+        if (Index >= 0 && Index < TrackedBits.Num())
+        {
+            TrackedBits[Index] = false;
+        }
+    }
+
+    int32 Num() const
+    {
+        return NumWrappers;
+    }
+
+    // releases every wrapper, objects stay tracked so the data kept in other containers is still cleaned up on delete
+    void Empty()
+    {
+        Pages.Empty();
+        WrapperBits.SetRange(0, WrapperBits.Num(), false);
+        NumWrappers = 0;
+    }
+
+private:
+    static constexpr int32 PageBits = 10;
+    static constexpr int32 PageSize = 1 << PageBits;
+
+    struct FSlot
+    {
+        const UObjectBase* Object = nullptr;
+        int32 SerialNumber = 0;
+        v8::UniquePersistent<v8::Value> Value;
+    };
+
+    FORCEINLINE bool HasWrapper(int32 Index) const
+    {
+        return Index >= 0 && Index < WrapperBits.Num() && WrapperBits[Index];
+    }
+
+    FORCEINLINE FSlot& GetSlot(int32 Index)
+    {
+        return Pages[Index >> PageBits][Index & (PageSize - 1)];
+    }
+
+    FSlot& GetOrAllocateSlot(int32 Index)
+    {
+        const int32 PageIndex = Index >> PageBits;
+        if (PageIndex >= Pages.Num())
+        {
+            Pages.SetNum(PageIndex + 1);
+        }
+        if (!Pages[PageIndex])
+        {
+            Pages[PageIndex] = MakeUnique<FSlot[]>(PageSize);
+        }
+        return GetSlot(Index);
+    }
+
+    void GrowBits(int32 Index)
+    {
+        check(Index >= 0);
+        if (Index >= TrackedBits.Num())
+        {
+            // grow to the current capacity of the object array, so the bitsets don't reallocate every few new objects
+            const int32 NewNum = FMath::Max(Index + 1, GUObjectArray.GetObjectArrayNum());
+            WrapperBits.Add(false, NewNum - WrapperBits.Num());
+            TrackedBits.Add(false, NewNum - TrackedBits.Num());
+        }
+    }
+
+    TArray<TUniquePtr<FSlot[]>> Pages;
+
+    TBitArray<> WrapperBits;
+
+    TBitArray<> TrackedBits;
+
+    int32 NumWrappers;
+};
+}    // namespace PUERTS_NAMESPACE
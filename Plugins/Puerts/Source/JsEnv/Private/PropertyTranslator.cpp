@@ -406,7 +406,7 @@ public:
     v8::Local<v8::Value> UEToJs(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const void* ValuePtr, bool PassByPointer) const override
     {
-        return FV8Utils::ToV8String(Isolate, NameProperty->GetPropertyValue(ValuePtr));
+        return FV8Utils::IsolateData<IObjectMapper>(Isolate)->NameToJs(Isolate, NameProperty->GetPropertyValue(ValuePtr));
     }
 
     bool JsToUE(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* ValuePtr,
@@ -423,7 +423,7 @@ public:
                 return true;
             }
         }
-        NameProperty->SetPropertyValue(ValuePtr, FV8Utils::ToFName(Isolate, Value));
+        NameProperty->SetPropertyValue(ValuePtr, FV8Utils::IsolateData<IObjectMapper>(Isolate)->JsToName(Isolate, Value));
         return true;
     }
 };
@@ -668,8 +668,9 @@ public:
 
         if (!PassByPointer)
         {
-            // FScriptStructWrapper::Alloc using new, so delete in static wrapper is safe
-            Ptr = FScriptStructWrapper::Alloc(StructProperty->Struct);
+            // FScriptStructWrapper::Free knows pool memory, the rest comes from new, so delete in static wrapper is safe
+            Ptr = FScriptStructWrapper::Alloc(
+                StructProperty->Struct, FV8Utils::IsolateData<IObjectMapper>(Isolate)->GetStructMemoryPool());
             StructProperty->CopySingleValue(Ptr, ValuePtr);
         }
         return FV8Utils::IsolateData<IObjectMapper>(Isolate)->FindOrAddStruct(
@@ -900,12 +901,32 @@ public:
             }
             else
             {
+                // the native function may resize it through the out parameter
+                FV8Utils::IsolateData<IObjectMapper>(Isolate)->InvalidateArrayView(
+                    Isolate, Context, static_cast<FScriptArray*>(Ptr));
                 FMemory::Memcpy(ValuePtr, Ptr, sizeof(FScriptArray));
             }
         }
         return true;
     }
 
+    virtual bool JsToUEFast(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value,
+        void* TempBuff, void** OutValuePtr) const override
+    {
+        void* Ptr = FV8Utils::GetPointer(Context, Value);
+
+        // only a non const reference gets the js array as is, the native function may resize it
+        // a const reference still gets a copy, so the callee never sees the array change under it
+        if (Ptr && ParamShallowCopySize)
+        {
+            FV8Utils::IsolateData<IObjectMapper>(Isolate)->InvalidateArrayView(Isolate, Context, static_cast<FScriptArray*>(Ptr));
+            *OutValuePtr = Ptr;
+            return true;
+        }
+        *OutValuePtr = TempBuff;
+        return JsToUE(Isolate, Context, Value, TempBuff, false);
+    }
+
 private:
 };
 
@@ -0,0 +1,91 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "StructMemoryPool.h"
+#include "PuertsStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Struct Pool Allocs"), STAT_PuertsStructPoolAllocs, STATGROUP_Puerts);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Struct Pool Frees"), STAT_PuertsStructPoolFrees, STATGROUP_Puerts);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Struct Allocs Outside Pool"), STAT_PuertsStructPoolMisses, STATGROUP_Puerts);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Struct Pool Slabs"), STAT_PuertsStructPoolSlabs, STATGROUP_Puerts);
+DECLARE_MEMORY_STAT(TEXT("Struct Pool Memory"), STAT_PuertsStructPoolMemory, STATGROUP_Puerts);
+
+namespace PUERTS_NAMESPACE
+{
+FStructMemoryPool::~FStructMemoryPool()
+{
+    Reset();
+}
+
+void* FStructMemoryPool::Alloc(int32 Size, int32 Alignment)
+{
+    // block sizes are multiples of Granularity and slabs are aligned to their size, so every block is Granularity aligned
+    if (Size <= 0 || Size > MaxBlockSize || Alignment > Granularity)
+    {
+        INC_DWORD_STAT(STAT_PuertsStructPoolMisses);
+        return nullptr;
+    }
+
+    const int32 ClassIndex = (Size - 1) / Granularity;
+    FSizeClass& SizeClass = SizeClasses[ClassIndex];
+    INC_DWORD_STAT(STAT_PuertsStructPoolAllocs);
+
+    if (FFreeBlock* Block = SizeClass.FreeList)
+    {
+        SizeClass.FreeList = Block->Next;
+        return Block;
+    }
+
+    const int32 BlockSize = (ClassIndex + 1) * Granularity;
+    if (SizeClass.Cursor + BlockSize > SizeClass.End)
+    {
+        uint8* Slab = static_cast<uint8*>(FMemory::Malloc(SlabSize, SlabSize));
+        SlabSizeClasses.Add(UPTRINT(Slab), ClassIndex);
+        SizeClass.Cursor = Slab;
+        SizeClass.End = Slab + SlabSize;
+        INC_DWORD_STAT(STAT_PuertsStructPoolSlabs);
+        INC_MEMORY_STAT_BY(STAT_PuertsStructPoolMemory, SlabSize);
+    }
+
+    void* Block = SizeClass.Cursor;
+    SizeClass.Cursor += BlockSize;
+    return Block;
+}
+
+bool FStructMemoryPool::Free(void* Ptr)
+{
+    const int32* ClassIndex = SlabSizeClasses.Find(UPTRINT(Ptr) & ~UPTRINT(SlabSize - 1));
+    if (!ClassIndex)
+    {
+        return false;
+    }
+
+    FSizeClass& SizeClass = SizeClasses[*ClassIndex];
+    FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+    Block->Next = SizeClass.FreeList;
+    SizeClass.FreeList = Block;
+    INC_DWORD_STAT(STAT_PuertsStructPoolFrees);
+    return true;
+}
+
+void FStructMemoryPool::Reset()
+{
+    for (auto& KV : SlabSizeClasses)
+    {
+        FMemory::Free(reinterpret_cast<void*>(KV.Key));
+    }
+    DEC_DWORD_STAT_BY(STAT_PuertsStructPoolSlabs, SlabSizeClasses.Num());
+    DEC_MEMORY_STAT_BY(STAT_PuertsStructPoolMemory, SlabSizeClasses.Num() * SlabSize);
+    SlabSizeClasses.Empty();
+
+    for (FSizeClass& SizeClass : SizeClasses)
+    {
+        SizeClass = FSizeClass();
+    }
+}
+}    // namespace PUERTS_NAMESPACE
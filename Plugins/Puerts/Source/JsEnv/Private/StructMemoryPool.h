@@ -0,0 +1,67 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NamespaceDef.h"
+
+namespace PUERTS_NAMESPACE
+{
+// slab pool for the struct instances js creates, they are small, short lived and mostly of a handful of sizes
+// (vectors, rotators, transforms...). blocks are carved from 64k slabs, one size class per slab, and go back to a free list of their class when freed.
+// a pointer belongs to the pool if the slab it falls in is one of ours, so memory that came from anywhere else can be told apart.
+// not thread safe, each env owns one and only uses it from the thread that runs js.
+class FStructMemoryPool
+{
+public:
+    FStructMemoryPool() = default;
+
+    ~FStructMemoryPool();
+
+    FStructMemoryPool(const FStructMemoryPool&) = delete;
+    FStructMemoryPool& operator=(const FStructMemoryPool&) = delete;
+
+    // returns nullptr if the size or alignment is more than the pool handles, the caller should fall back to the heap
+    void* Alloc(int32 Size, int32 Alignment);
+
+    // returns false if the memory doesn't belong to the pool
+    bool Free(void* Ptr);
+
+    FORCEINLINE bool Owns(const void* Ptr) const
+    {
+        return SlabSizeClasses.Contains(UPTRINT(Ptr) & ~UPTRINT(SlabSize - 1));
+    }
+
+    // releases every slab at once, all the memory handed out becomes invalid
+    void Reset();
+
+private:
+    static constexpr int32 SlabSize = 64 * 1024;
+    static constexpr int32 Granularity = 16;
+    static constexpr int32 MaxBlockSize = 256;
+    static constexpr int32 NumSizeClasses = MaxBlockSize / Granularity;
+
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    struct FSizeClass
+    {
+        FFreeBlock* FreeList = nullptr;
+        uint8* Cursor = nullptr;
+        uint8* End = nullptr;
+    };
+
+    FSizeClass SizeClasses[NumSizeClasses];
+
+    // slab base address -> size class of its blocks
+    TMap<UPTRINT, int32> SlabSizeClasses;
+};
+}    // namespace PUERTS_NAMESPACE
@@ -617,7 +617,7 @@ void FScriptStructWrapper::New(
             }
             else
             {
-                Memory = Alloc(static_cast<UScriptStruct*>(Struct.Get()));
+                Memory = Alloc(static_cast<UScriptStruct*>(Struct.Get()), MemoryPool);
                 const int Count = Info.Length() < Properties.size() ? Info.Length() : Properties.size();
                 for (int i = 0; i < Count; ++i)
                 {
@@ -633,16 +633,29 @@ void FScriptStructWrapper::New(
     }
 }
 
-void* FScriptStructWrapper::Alloc(UScriptStruct* InScriptStruct)
+void* FScriptStructWrapper::Alloc(UScriptStruct* InScriptStruct, FStructMemoryPool* Pool)
 {
-    void* ScriptStructMemory = new char[InScriptStruct->GetStructureSize()];
+    void* ScriptStructMemory =
+        Pool ? Pool->Alloc(InScriptStruct->GetStructureSize(), InScriptStruct->GetMinAlignment()) : nullptr;
+    if (!ScriptStructMemory)
+    {
+        ScriptStructMemory = new char[InScriptStruct->GetStructureSize()];
+    }
     InScriptStruct->InitializeStruct(ScriptStructMemory);
     return ScriptStructMemory;
 }
 
-void FScriptStructWrapper::Free(TWeakObjectPtr<UStruct> InStruct, pesapi_finalize InExternalFinalize, void* Ptr)
+void FScriptStructWrapper::Free(
+    TWeakObjectPtr<UStruct> InStruct, pesapi_finalize InExternalFinalize, void* Ptr, FStructMemoryPool* Pool)
 {
-    if (InExternalFinalize)
+    if (Pool && Pool->Owns(Ptr))
+    {
+        // static bindings may have a finalizer, but it would delete memory it didn't allocate
+        if (InStruct.IsValid())
+            InStruct->DestroyStruct(Ptr);
+        Pool->Free(Ptr);
+    }
+    else if (InExternalFinalize)
     {
         InExternalFinalize(Ptr, nullptr, nullptr);
     }
@@ -659,7 +672,7 @@ void FScriptStructWrapper::OnGarbageCollectedWithFree(const v8::WeakCallbackInfo
     FScriptStructWrapper* ScriptStructWrapper = Data.GetParameter();
     void* ScriptStructMemory = DataTransfer::MakeAddressWithHighPartOfTwo(Data.GetInternalField(0), Data.GetInternalField(1));
     FV8Utils::IsolateData<IObjectMapper>(Data.GetIsolate())->UnBindStruct(ScriptStructWrapper, ScriptStructMemory);
-    Free(ScriptStructWrapper->Struct, ScriptStructWrapper->ExternalFinalize, ScriptStructMemory);
+    ScriptStructWrapper->Free(ScriptStructMemory);
 }
 
 void FScriptStructWrapper::OnGarbageCollected(const v8::WeakCallbackInfo<FScriptStructWrapper>& Data)
@@ -17,6 +17,7 @@
 #include "PropertyTranslator.h"
 #include "FunctionTranslator.h"
 #include "JSClassRegister.h"
+#include "StructMemoryPool.h"
 #include "NamespaceDef.h"
 
 #define PUERTS_REUSE_STRUCTWRAPPER_FUNCTIONTEMPLATE 1
@@ -26,7 +27,8 @@ namespace PUERTS_NAMESPACE
 class FStructWrapper
 {
 public:
-    explicit FStructWrapper(UStruct* InStruct) : ExternalInitialize(nullptr), ExternalFinalize(nullptr), Struct(InStruct)
+    explicit FStructWrapper(UStruct* InStruct)
+        : ExternalInitialize(nullptr), ExternalFinalize(nullptr), MemoryPool(nullptr), Struct(InStruct)
     {
     }
 
@@ -81,6 +83,9 @@ protected:
 
     pesapi_finalize ExternalFinalize;
 
+    // pool of the env that owns this wrapper, instances it creates take their memory from there
+    FStructMemoryPool* MemoryPool;
+
     TWeakObjectPtr<UStruct> Struct;
 
 #if PUERTS_KEEP_UOBJECT_REFERENCE
@@ -111,13 +116,16 @@ public:
 
     static void OnGarbageCollected(const v8::WeakCallbackInfo<FScriptStructWrapper>& Data);
 
-    static void* Alloc(UScriptStruct* InScriptStruct);
+    // takes the memory from the pool if given one, the heap otherwise
+    static void* Alloc(UScriptStruct* InScriptStruct, FStructMemoryPool* Pool = nullptr);
 
-    static void Free(TWeakObjectPtr<UStruct> InStruct, pesapi_finalize InExternalFinalize, void* Ptr);
+    // memory owned by the pool goes back to it, whoever created the instance
+    static void Free(
+        TWeakObjectPtr<UStruct> InStruct, pesapi_finalize InExternalFinalize, void* Ptr, FStructMemoryPool* Pool = nullptr);
 
     void Free(void* Ptr)
     {
-        Free(Struct, ExternalFinalize, Ptr);
+        Free(Struct, ExternalFinalize, Ptr, MemoryPool);
     }
 
     static void New(const v8::FunctionCallbackInfo<v8::Value>& Info);
@@ -1,11 +1,84 @@
 #include <V8Utils.h>
+#include "ObjectMapper.h"
+
+// FStrings of at least this many latin-1 chars go to js as external one byte strings: their data is kept outside the js heap and
+// never copied again by v8. 0 disables it
+#ifndef PUERTS_EXTERNAL_STRING_MIN_LENGTH
+#define PUERTS_EXTERNAL_STRING_MIN_LENGTH 0
+#endif
+
+#if !defined(WITH_QUICKJS) && PUERTS_EXTERNAL_STRING_MIN_LENGTH > 0
+namespace PUERTS_NAMESPACE
+{
+class FExternalOneByteString : public v8::String::ExternalOneByteStringResource
+{
+public:
+    FExternalOneByteString(const TCHAR* String, int32 Length)
+    {
+        Data.SetNumUninitialized(Length);
+        for (int32 i = 0; i < Length; ++i)
+        {
+            Data[i] = static_cast<ANSICHAR>(String[i]);
+        }
+    }
+
+    virtual const char* data() const override
+    {
+        return Data.GetData();
+    }
+
+    virtual size_t length() const override
+    {
+        return Data.Num();
+    }
+
+private:
+    TArray<ANSICHAR> Data;
+};
+}    // namespace PUERTS_NAMESPACE
+#endif
 
 v8::Local<v8::String> puerts::FV8Utils::ToV8String(v8::Isolate* Isolate, const TCHAR* String)
 {
+    return ToV8String(Isolate, String, FCString::Strlen(String));
+}
+
+v8::Local<v8::String> puerts::FV8Utils::ToV8String(v8::Isolate* Isolate, const TCHAR* String, int32 Length, bool Internalized)
+{
+    const v8::NewStringType Type = Internalized ? v8::NewStringType::kInternalized : v8::NewStringType::kNormal;
 #ifdef WITH_QUICKJS
-    return v8::String::NewFromUtf8(Isolate, TCHAR_TO_UTF8(String), v8::NewStringType::kNormal).ToLocalChecked();
+    return v8::String::NewFromUtf8(Isolate, TCHAR_TO_UTF8(String), Type).ToLocalChecked();
 #else
-    return v8::String::NewFromTwoByte(Isolate, TCHAR_TO_UTF16(String), v8::NewStringType::kNormal).ToLocalChecked();
+    bool OneByte = true;
+    for (int32 i = 0; i < Length; ++i)
+    {
+        if (String[i] > 0xFF)
+        {
+            OneByte = false;
+            break;
+        }
+    }
+
+    if (OneByte)
+    {
+#if PUERTS_EXTERNAL_STRING_MIN_LENGTH > 0
+        if (!Internalized && Length >= PUERTS_EXTERNAL_STRING_MIN_LENGTH)
+        {
+            return v8::String::NewExternalOneByte(Isolate, new FExternalOneByteString(String, Length)).ToLocalChecked();
+        }
+#endif
+        TArray<uint8, TInlineAllocator<256>> Buffer;
+        Buffer.SetNumUninitialized(Length);
+        for (int32 i = 0; i < Length; ++i)
+        {
+            Buffer[i] = static_cast<uint8>(String[i]);
+        }
+        return v8::String::NewFromOneByte(Isolate, Buffer.GetData(), Type, Length).ToLocalChecked();
+    }
+
+    FTCHARToUTF16 Converted(String, Length);
+    return v8::String::NewFromTwoByte(Isolate, reinterpret_cast<const uint16_t*>(Converted.Get()), Type, Converted.Length())
+        .ToLocalChecked();
 #endif
 }
 
@@ -17,25 +90,94 @@ FString puerts::FV8Utils::ToFString(v8::Isolate* Isolate, v8::Local<v8::Value> V
     // Implementation is referenced from v8::String::Value(), directly copy v8::String's content to FString
     if (!Value.IsEmpty())
     {
-        v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
-        v8::TryCatch TryCatch(Isolate);
         v8::Local<v8::String> Str;
-        if (Value->ToString(Context).ToLocal(&Str))
+        if (Value->IsString())
+        {
+            // no conversion needed, skip the TryCatch setup
+            Str = Value.As<v8::String>();
+        }
+        else
         {
-            const int Length = Str->Length();
-            if (Length > 0)
+            v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+            v8::TryCatch TryCatch(Isolate);
+            if (!Value->ToString(Context).ToLocal(&Str))
             {
-                FString Ret;
-                TArray<TCHAR>& CharArray = Ret.GetCharArray();
-                CharArray.AddUninitialized(Length + 1);
-                uint16_t* RetBuffer = reinterpret_cast<uint16_t*>(CharArray.GetData());
-                Str->Write(Isolate, RetBuffer);
-                // v8::String::Write() doesn't write a null terminator to RetBuffer, so we have to do it ourselves
-                *(RetBuffer + Length) = TEXT('\0');
-                return Ret;
+                return TEXT("");
             }
         }
+
+        const int Length = Str->Length();
+        if (Length > 0)
+        {
+            FString Ret;
+            TArray<TCHAR>& CharArray = Ret.GetCharArray();
+            CharArray.AddUninitialized(Length + 1);
+            uint16_t* RetBuffer = reinterpret_cast<uint16_t*>(CharArray.GetData());
+            Str->Write(Isolate, RetBuffer);
+            // v8::String::Write() doesn't write a null terminator to RetBuffer, so we have to do it ourselves
+            *(RetBuffer + Length) = TEXT('\0');
+            return Ret;
+        }
     }
     return TEXT("");
 #endif
-}
\ No newline at end of file
+}
+
+FName puerts::FV8Utils::ToFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
+{
+#ifdef WITH_QUICKJS
+    return UTF8_TO_TCHAR(*(v8::String::Utf8Value(Isolate, Value)));
+#else
+    if (Value.IsEmpty() || !Value->IsString())
+    {
+        return FName(*ToFString(Isolate, Value));
+    }
+
+    auto Str = Value.As<v8::String>();
+    const int Length = Str->Length();
+    if (Length == 0)
+    {
+        return NAME_None;
+    }
+    if (Length >= NAME_SIZE)
+    {
+        return FName(*ToFString(Isolate, Str));
+    }
+
+    // names are short, written straight into a stack buffer instead of a utf8 copy plus a conversion
+    if (Str->IsOneByte())
+    {
+        ANSICHAR Buffer[NAME_SIZE];
+        Str->WriteOneByte(Isolate, reinterpret_cast<uint8_t*>(Buffer), 0, Length, v8::String::NO_NULL_TERMINATION);
+        Buffer[Length] = '\0';
+        bool Ascii = true;
+        for (int i = 0; i < Length; ++i)
+        {
+            if (static_cast<uint8>(Buffer[i]) > 0x7F)
+            {
+                Ascii = false;
+                break;
+            }
+        }
+        if (Ascii)
+        {
+            return FName(Buffer);
+        }
+    }
+
+    TCHAR Buffer[NAME_SIZE];
+    Str->Write(Isolate, reinterpret_cast<uint16_t*>(Buffer), 0, Length, v8::String::NO_NULL_TERMINATION);
+    Buffer[Length] = TEXT('\0');
+    return FName(Buffer);
+#endif
+}
+
+FName puerts::FV8Utils::ToCachedFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
+{
+    return IsolateData<IObjectMapper>(Isolate)->JsToName(Isolate, Value);
+}
+
+v8::Local<v8::String> puerts::FV8Utils::ToCachedV8String(v8::Isolate* Isolate, const FName& Name)
+{
+    return IsolateData<IObjectMapper>(Isolate)->NameToJs(Isolate, Name);
+}
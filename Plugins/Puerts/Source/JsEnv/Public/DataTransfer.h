@@ -330,6 +330,10 @@ public:
     static v8::Local<v8::Value> FindOrAddStruct(
         v8::Isolate* Isolate, v8::Local<v8::Context> Context, UScriptStruct* ScriptStruct, void* Ptr, bool PassByPointer);
 
+    // memory for a struct instance handed over to js, taken from the pool of the env. nullptr if the pool can't serve it,
+    // memory from anywhere else must then be used
+    static void* AllocStructMemory(v8::Isolate* Isolate, int32 Size, int32 Alignment);
+
     template <typename T>
     static bool IsInstanceOf(v8::Isolate* Isolate, v8::Local<v8::Value> JsObject)
     {
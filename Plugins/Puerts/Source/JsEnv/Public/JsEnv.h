@@ -96,6 +96,11 @@ public:
 
     void InitExtensionMethodsMap();
 
+    // lets optimized js call the scalar native UFUNCTIONs of Class through the v8 fast api, which is only sound if none of them
+    // can call back into js or destroy an object. only affects classes that no env has used yet, does nothing unless
+    // WITH_V8_FAST_CALL is defined
+    static void AllowFastApiCalls(UClass* Class);
+
 private:
     std::unique_ptr<IJsEnv> GameScript;
 };
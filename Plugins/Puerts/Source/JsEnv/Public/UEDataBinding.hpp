@@ -173,7 +173,7 @@ struct Converter<FName>
 {
     static v8::Local<v8::Value> toScript(v8::Local<v8::Context> context, FName value)
     {
-        return FV8Utils::ToV8String(context->GetIsolate(), value.ToString());
+        return FV8Utils::ToCachedV8String(context->GetIsolate(), value);
     }
 
     static FName toCpp(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)
@@ -188,7 +188,7 @@ struct Converter<FName>
                 return *static_cast<FName*>(Data);
             }
         }
-        return FV8Utils::ToFName(context->GetIsolate(), value);
+        return FV8Utils::ToCachedFName(context->GetIsolate(), value);
     }
 
     static bool accept(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)
@@ -547,7 +547,10 @@ struct Converter<T, typename std::enable_if<internal::IsUStructHelper<T>::value>
 {
     static v8::Local<v8::Value> toScript(v8::Local<v8::Context> context, const T value)
     {
-        return DataTransfer::FindOrAddStruct<T>(context->GetIsolate(), context, new T(value), false);
+        // values returned by the generated bindings (vector math and such) are the bulk of the short lived structs
+        void* Memory = DataTransfer::AllocStructMemory(context->GetIsolate(), sizeof(T), alignof(T));
+        T* Ptr = Memory ? new (Memory) T(value) : new T(value);
+        return DataTransfer::FindOrAddStruct<T>(context->GetIsolate(), context, Ptr, false);
     }
 
     static T toCpp(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)
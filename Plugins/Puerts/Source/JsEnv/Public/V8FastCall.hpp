@@ -182,9 +182,16 @@ template <typename Inc, typename Ret, typename... Args, Ret (Inc::*func)(Args...
 struct V8FastCall<Ret (Inc::*)(Args...), func,
     typename std::enable_if<IsReturnSupportedHelper<Ret>::value && IsArgsSupportedHelper<std::tuple<Args...>>::value>::type>
 {
-    static Ret Wrap(v8::Local<v8::Object> receiver_obj, typename FastCallArgument<Args>::DeclType... args)
+    static Ret Wrap(
+        v8::Local<v8::Object> receiver_obj, typename FastCallArgument<Args>::DeclType... args, v8::FastApiCallbackOptions& options)
     {
         auto self = FastCallArgument<Inc*>::Get(receiver_obj);
+        if (V8_UNLIKELY(!self))
+        {
+            // let the slow callback throw
+            options.fallback = true;
+            return Ret();
+        }
         return (self->*func)(FastCallArgument<Args>::Get(args)...);
     }
 
@@ -199,9 +206,16 @@ template <typename Inc, typename Ret, typename... Args, Ret (Inc::*func)(Args...
 struct V8FastCall<Ret (Inc::*)(Args...) const, func,
     typename std::enable_if<IsReturnSupportedHelper<Ret>::value && IsArgsSupportedHelper<std::tuple<Args...>>::value>::type>
 {
-    static Ret Wrap(v8::Local<v8::Object> receiver_obj, typename FastCallArgument<Args>::DeclType... args)
+    static Ret Wrap(
+        v8::Local<v8::Object> receiver_obj, typename FastCallArgument<Args>::DeclType... args, v8::FastApiCallbackOptions& options)
     {
         auto self = FastCallArgument<Inc*>::Get(receiver_obj);
+        if (V8_UNLIKELY(!self))
+        {
+            // let the slow callback throw
+            options.fallback = true;
+            return Ret();
+        }
         return (self->*func)(FastCallArgument<Args>::Get(args)...);
     }
 
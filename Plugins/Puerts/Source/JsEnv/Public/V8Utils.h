@@ -100,18 +100,25 @@ public:
 
     static FString ToFString(v8::Isolate* Isolate, v8::Local<v8::Value> Value);
 
-    FORCEINLINE static FName ToFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
-    {
-        return UTF8_TO_TCHAR(*(v8::String::Utf8Value(Isolate, Value)));
-    }
+    static FName ToFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value);
+
+    // same as ToFName / ToV8String, through the name cache of the env that owns the isolate
+    static FName ToCachedFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value);
+
+    static v8::Local<v8::String> ToCachedV8String(v8::Isolate* Isolate, const FName& Name);
 
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FString& String)
     {
         // return ToV8String(Isolate, TCHAR_TO_UTF8(*String));
-        return ToV8String(Isolate, *String);
+        return ToV8String(Isolate, *String, String.Len());
     }
 
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FName& String)
+    {
+        return ToV8String(Isolate, NameToFString(String));
+    }
+
+    FORCEINLINE static FString NameToFString(const FName& String)
     {
         const FNameEntry* Entry = String.GetComparisonNameEntry();
         FString Out;
@@ -129,7 +136,7 @@ public:
             Out.AppendInt(NAME_INTERNAL_TO_EXTERNAL(String.GetNumber()));
         }
 
-        return ToV8String(Isolate, Out);
+        return Out;
     }
 
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FText& String)
@@ -139,6 +146,9 @@ public:
 
     static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const TCHAR* String);
 
+    // latin-1 content goes to v8 as a one byte string, long ones optionally as external strings (see PUERTS_EXTERNAL_STRING_MIN_LENGTH)
+    static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const TCHAR* String, int32 Length, bool Internalized = false);
+
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const char* String)
     {
         return v8::String::NewFromUtf8(Isolate, String, v8::NewStringType::kNormal).ToLocalChecked();
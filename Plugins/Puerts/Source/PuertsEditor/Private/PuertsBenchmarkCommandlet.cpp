@@ -0,0 +1,35 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+
+#include "PuertsBenchmarkCommandlet.h"
+
+DEFINE_LOG_CATEGORY(LogPuertsBenchmark);
+
+UPuertsBenchmarkCommandlet::UPuertsBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+TUniquePtr<PUERTS_NAMESPACE::FJsEnv> UPuertsBenchmarkCommandlet::StartBenchmarkScript(
+    const TCHAR* ModuleName, const TCHAR* ArgumentName, UObject* Argument)
+{
+    TUniquePtr<PUERTS_NAMESPACE::FJsEnv> JsEnv = MakeUnique<PUERTS_NAMESPACE::FJsEnv>();
+    TArray<TPair<FString, UObject*>> Arguments;
+    Arguments.Add(TPair<FString, UObject*>(ArgumentName, Argument));
+    JsEnv->Start(ModuleName, Arguments);
+    return JsEnv;
+}
+
+void UPuertsBenchmarkCommandlet::RunBenchmarkScript(const TCHAR* ModuleName, const TCHAR* ArgumentName, UObject* Argument)
+{
+    StartBenchmarkScript(ModuleName, ArgumentName, Argument);
+}
@@ -0,0 +1,37 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JsEnv.h"
+#include "PuertsBenchmarkCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogPuertsBenchmark, Log, All);
+
+// base of the Puerts*Benchmark commandlets: they run in the editor, without client or server, log to the console and hand one
+// object to their PuertsEditor/*Benchmark.js script, which reads the parameters from it and reports its results through it
+UCLASS(Abstract)
+class UPuertsBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPuertsBenchmarkCommandlet();
+
+protected:
+    // starts the script with Argument bound to ArgumentName. the script runs its workloads from its top level, the env (and any
+    // timer, delegate or mixin the script left behind) stays alive until the returned pointer is released
+    TUniquePtr<PUERTS_NAMESPACE::FJsEnv> StartBenchmarkScript(
+        const TCHAR* ModuleName, const TCHAR* ArgumentName, UObject* Argument);
+
+    // starts the script and tears the env down once its top level returned
+    void RunBenchmarkScript(const TCHAR* ModuleName, const TCHAR* ArgumentName, UObject* Argument);
+};
@@ -0,0 +1,31 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsContainerBenchmark.h"
+#include "Misc/Parse.h"
+
+int32 UPuertsContainerBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 100;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+    UPuertsContainerBenchmarkTarget* Target = NewObject<UPuertsContainerBenchmarkTarget>();
+    Target->AddToRoot();
+    Target->Iterations = FMath::Max(Iterations, 1);
+
+    RunBenchmarkScript(TEXT("PuertsEditor/ContainerBenchmark"), TEXT("Target"), Target);
+
+    const int32 Mismatches = Target->Mismatches;
+    Target->RemoveFromRoot();
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogPuertsBenchmark, Error, TEXT("%d transfers returned wrong data"), Mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsContainerBenchmark.generated.h"
+
+// containers js reads and writes element by element or in bulk, Fill sets every one of them to Count known elements
+UCLASS()
+class UPuertsContainerBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+
+    UPROPERTY()
+    int32 Mismatches = 0;
+
+    UPROPERTY()
+    TArray<FVector> Points;
+
+    UPROPERTY()
+    TArray<float> Values;
+
+    UPROPERTY()
+    TSet<int32> Ids;
+
+    UPROPERTY()
+    TMap<int32, float> Scores;
+
+    UFUNCTION()
+    void Fill(int32 Count)
+    {
+        Points.Reset(Count);
+        Values.Reset(Count);
+        Ids.Reset();
+        Scores.Reset();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Points.Add(FVector(i, i + 1, i + 2));
+            Values.Add(i * 0.5f);
+            Ids.Add(i);
+            Scores.Add(i, i * 0.25f);
+        }
+    }
+
+    UFUNCTION()
+    double SumOf(const TArray<float>& InValues) const
+    {
+        double Sum = 0;
+        for (float Value : InValues)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    }
+
+    UFUNCTION()
+    void AppendValue(TArray<float>& InOutValues, float Value) const
+    {
+        InOutValues.Add(Value);
+    }
+
+    UFUNCTION()
+    double SumPoints() const
+    {
+        double Sum = 0;
+        for (const FVector& Point : Points)
+        {
+            Sum += Point.X + Point.Y + Point.Z;
+        }
+        return Sum;
+    }
+};
+
+// runs PuertsEditor/ContainerBenchmark.js, which moves 10, 1k and 100k elements between the containers and js one Get/Set/Add
+// at a time and with ToTypedArray/FromTypedArray/ToArray, checking both give the same data. GetTypedArrayView goes through arrays
+// created by js, as it refuses the ones native code owns.
+// fails if they don't. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsContainerBenchmark -Iterations=100
+UCLASS()
+class UPuertsContainerBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
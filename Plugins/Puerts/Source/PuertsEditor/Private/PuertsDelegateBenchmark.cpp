@@ -0,0 +1,67 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsDelegateBenchmark.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "UObject/UObjectGlobals.h"
+#include "UECompatible.h"
+
+int32 UPuertsDelegateBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 NumDelegates = 50000;
+    int32 Frames = 600;
+    int32 GCInterval = 30;
+    FParse::Value(*Params, TEXT("Delegates="), NumDelegates);
+    FParse::Value(*Params, TEXT("Frames="), Frames);
+    FParse::Value(*Params, TEXT("GCInterval="), GCInterval);
+    Frames = FMath::Max(Frames, 1);
+    GCInterval = FMath::Max(GCInterval, 1);
+
+    UPuertsDelegateBenchmarkArgs* Args = NewObject<UPuertsDelegateBenchmarkArgs>();
+    Args->AddToRoot();
+    Args->Targets.Reserve(NumDelegates);
+    for (int32 i = 0; i < NumDelegates; ++i)
+    {
+        Args->Targets.Add(NewObject<UPuertsDelegateBenchmarkTarget>());
+    }
+
+    {
+        TUniquePtr<PUERTS_NAMESPACE::FJsEnv> JsEnv =
+            StartBenchmarkScript(TEXT("PuertsEditor/DelegateBenchmark"), TEXT("Args"), Args);
+
+        // the targets are released evenly over the run, so every gc has owners to reclaim
+        const int32 ReleasePerFrame = FMath::Max(NumDelegates / Frames, 1);
+        const float DeltaTime = 1.0f / 60.0f;
+        double TotalTime = 0;
+        double WorstTime = 0;
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            const int32 NewNum = FMath::Max(Args->Targets.Num() - ReleasePerFrame, 0);
+            Args->Targets.SetNum(NewNum);
+
+            const double Start = FPlatformTime::Seconds();
+            FUETicker::GetCoreTicker().Tick(DeltaTime);
+            if ((Frame + 1) % GCInterval == 0)
+            {
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            }
+            const double Elapsed = FPlatformTime::Seconds() - Start;
+            TotalTime += Elapsed;
+            WorstTime = FMath::Max(WorstTime, Elapsed);
+        }
+
+        UE_LOG(LogPuertsBenchmark, Display, TEXT("%d delegates, %d frames, avg frame %.3f ms, worst frame %.3f ms"), NumDelegates,
+            Frames, TotalTime * 1000.0 / Frames, WorstTime * 1000.0);
+    }
+
+    Args->RemoveFromRoot();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    return 0;
+}
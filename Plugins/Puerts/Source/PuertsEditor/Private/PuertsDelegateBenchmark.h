@@ -0,0 +1,49 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsDelegateBenchmark.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FPuertsDelegateBenchmarkEvent);
+
+// owner of one of the multicast delegates the benchmark script binds to
+UCLASS()
+class UPuertsDelegateBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FPuertsDelegateBenchmarkEvent OnEvent;
+};
+
+// handed to the benchmark script, which binds a js callback to the delegate of every target
+UCLASS()
+class UPuertsDelegateBenchmarkArgs : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<UPuertsDelegateBenchmarkTarget*> Targets;
+};
+
+// binds 50k multicast delegates from js, then releases a slice of their owners every frame and collects garbage periodically.
+// reports the average and worst frame (core ticker plus gc), run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsDelegateBenchmark -Delegates=50000 -Frames=600 -GCInterval=30
+UCLASS()
+class UPuertsDelegateBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
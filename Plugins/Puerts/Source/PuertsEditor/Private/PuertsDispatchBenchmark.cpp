@@ -0,0 +1,54 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsDispatchBenchmark.h"
+#include "Misc/Parse.h"
+
+int32 UPuertsDispatchBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 100000;
+    int32 Frames = 100;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    FParse::Value(*Params, TEXT("Frames="), Frames);
+
+    UPuertsDispatchBenchmarkTarget* Target = NewObject<UPuertsDispatchBenchmarkTarget>();
+    Target->AddToRoot();
+    Target->Iterations = FMath::Max(Iterations, 1);
+
+    {
+        TUniquePtr<PUERTS_NAMESPACE::FJsEnv> JsEnv =
+            StartBenchmarkScript(TEXT("PuertsEditor/DispatchBenchmark"), TEXT("Target"), Target);
+
+        // the mixed in Step returns Value * 2 + 1, a frame sums to Iterations squared
+        const int64 Expected = static_cast<int64>(Target->Iterations) * Target->Iterations;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            const int64 Sum = Target->RunFrame(Target->Iterations);
+            if (Sum != Expected)
+            {
+                if (Target->Mismatches < 8)
+                {
+                    UE_LOG(LogPuertsBenchmark, Error, TEXT("frame %d summed to %lld, expected %lld"), Frame, Sum, Expected);
+                }
+                ++Target->Mismatches;
+            }
+        }
+        UE_LOG(LogPuertsBenchmark, Display, TEXT("dispatch benchmark, from c++: %.1f ms per frame of %d calls"),
+            (FPlatformTime::Seconds() - Start) * 1000 / FMath::Max(Frames, 1), Target->Iterations);
+    }
+
+    const int32 Mismatches = Target->Mismatches;
+    Target->RemoveFromRoot();
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogPuertsBenchmark, Error, TEXT("%d calls returned a wrong result"), Mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsDispatchBenchmark.generated.h"
+
+// Step gets mixed in from js, calling it from c++ goes the way a blueprint event overridden in ts does
+UCLASS()
+class UPuertsDispatchBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+
+    UPROPERTY()
+    int32 Mismatches = 0;
+
+    UFUNCTION(BlueprintNativeEvent)
+    int32 Step(int32 Value);
+
+    int32 Step_Implementation(int32 Value)
+    {
+        return Value;
+    }
+
+    // one frame worth of calls into js, the sum of every result
+    UFUNCTION()
+    int64 RunFrame(int32 Calls)
+    {
+        int64 Sum = 0;
+        for (int32 i = 0; i < Calls; ++i)
+        {
+            Sum += Step(i);
+        }
+        return Sum;
+    }
+};
+
+// runs PuertsEditor/DispatchBenchmark.js, which mixes Step in, checks it and times frames of calls made from inside js.
+// the commandlet then times the same frames called from c++ with no js on the stack, the way the engine ticks them.
+// fails if any result is wrong. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsDispatchBenchmark -Iterations=100000 -Frames=100
+UCLASS()
+class UPuertsDispatchBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
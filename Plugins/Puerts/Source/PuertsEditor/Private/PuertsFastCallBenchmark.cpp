@@ -0,0 +1,41 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsFastCallBenchmark.h"
+#include "Misc/Parse.h"
+
+int32 UPuertsFastCallBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 10000000;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+#ifdef WITH_V8_FAST_CALL
+    UE_LOG(LogPuertsBenchmark, Display, TEXT("v8 fast api calls enabled"));
+#else
+    UE_LOG(LogPuertsBenchmark, Warning,
+        TEXT("v8 fast api calls disabled in this build, the check only compares the regular call path with itself"));
+#endif
+
+    // its functions only read members, so it is safe to call them from optimized code
+    PUERTS_NAMESPACE::FJsEnv::AllowFastApiCalls(UPuertsFastCallBenchmarkTarget::StaticClass());
+
+    UPuertsFastCallBenchmarkTarget* Target = NewObject<UPuertsFastCallBenchmarkTarget>();
+    Target->AddToRoot();
+    Target->Iterations = FMath::Max(Iterations, 1);
+
+    RunBenchmarkScript(TEXT("PuertsEditor/FastCallBenchmark"), TEXT("Target"), Target);
+
+    const int32 Mismatches = Target->Mismatches;
+    Target->RemoveFromRoot();
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogPuertsBenchmark, Error, TEXT("%d results differ between the fast and the regular call path"), Mismatches);
+        return 1;
+    }
+    return 0;
+}
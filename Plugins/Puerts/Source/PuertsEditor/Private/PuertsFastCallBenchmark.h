@@ -0,0 +1,119 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsFastCallBenchmark.generated.h"
+
+UENUM()
+enum class EPuertsFastCallBenchmarkState : uint8
+{
+    Idle,
+    Moving,
+    Dead
+};
+
+// UFUNCTIONs with scalar signatures, which optimized js calls through the v8 fast api when it is enabled (the commandlet opts
+// the class in), plus a struct getter that always takes the regular callback, for reference
+UCLASS()
+class UPuertsFastCallBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+
+    UPROPERTY()
+    int32 Mismatches = 0;
+
+    UPROPERTY()
+    float Health = 100.0f;
+
+    UPROPERTY()
+    int32 Ammo = 30;
+
+    UPROPERTY()
+    FVector Location = FVector(1.0f, 2.0f, 3.0f);
+
+    UFUNCTION()
+    float GetHealth() const
+    {
+        return Health;
+    }
+
+    UFUNCTION()
+    int32 GetAmmo() const
+    {
+        return Ammo;
+    }
+
+    UFUNCTION()
+    bool IsAlive() const
+    {
+        return Health > 0.0f;
+    }
+
+    UFUNCTION()
+    FVector GetLocation() const
+    {
+        return Location;
+    }
+
+    UFUNCTION()
+    int32 AddInts(int32 A, int32 B) const
+    {
+        return static_cast<int32>(static_cast<uint32>(A) + static_cast<uint32>(B));
+    }
+
+    UFUNCTION()
+    double ScaleValue(float Value, double Scale) const
+    {
+        return Value * Scale;
+    }
+
+    UFUNCTION()
+    uint8 ToByte(int32 Value) const
+    {
+        return static_cast<uint8>(Value);
+    }
+
+    UFUNCTION()
+    int32 Select(bool Condition, int32 A, int32 B) const
+    {
+        return Condition ? A : B;
+    }
+
+    UFUNCTION()
+    EPuertsFastCallBenchmarkState NextState(EPuertsFastCallBenchmarkState State) const
+    {
+        return static_cast<EPuertsFastCallBenchmarkState>((static_cast<uint8>(State) + 1) % 3);
+    }
+
+    UFUNCTION()
+    bool IsSameObject(UObject* Object) const
+    {
+        return Object == this;
+    }
+};
+
+// runs PuertsEditor/FastCallBenchmark.js, which first checks that hot loops (where turbofan uses the fast api) return the same
+// as the interpreter (which always takes the regular callback) for every signature kind, then logs the time of tight getter loops.
+// fails if any result differs. without WITH_V8_FAST_CALL (anything but v8 10.6 on linux x64) both sides take the regular
+// callback, the check can't fail and the timings are the baseline. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsFastCallBenchmark -Iterations=10000000
+UCLASS()
+class UPuertsFastCallBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
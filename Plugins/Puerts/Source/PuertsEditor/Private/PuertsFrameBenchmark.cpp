@@ -0,0 +1,31 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsFrameBenchmark.h"
+#include "Misc/Parse.h"
+
+int32 UPuertsFrameBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 1000000;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+    UPuertsFrameBenchmarkTarget* Target = NewObject<UPuertsFrameBenchmarkTarget>();
+    Target->AddToRoot();
+    Target->Iterations = FMath::Max(Iterations, 1);
+
+    RunBenchmarkScript(TEXT("PuertsEditor/FrameBenchmark"), TEXT("Target"), Target);
+
+    const int32 Mismatches = Target->Mismatches;
+    Target->RemoveFromRoot();
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogPuertsBenchmark, Error, TEXT("%d calls returned a wrong result"), Mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsFrameBenchmark.generated.h"
+
+// UFUNCTIONs with 0, 3 and 8 parameters, all scalar or mixed with strings, structs and containers.
+// none of them is const, so js always calls them through the regular reflection callback
+UCLASS()
+class UPuertsFrameBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+
+    UPROPERTY()
+    int32 Mismatches = 0;
+
+    UPROPERTY()
+    int32 Counter = 0;
+
+    UFUNCTION()
+    void Tick()
+    {
+        ++Counter;
+    }
+
+    UFUNCTION()
+    int32 Mix3(int32 A, float B, bool C)
+    {
+        return C ? A + static_cast<int32>(B) : A - static_cast<int32>(B);
+    }
+
+    UFUNCTION()
+    FString Describe3(const FString& Name, int32 Count, const FVector& Offset)
+    {
+        return FString::Printf(TEXT("%s:%d:%d"), *Name, Count, static_cast<int32>(Offset.X + Offset.Y + Offset.Z));
+    }
+
+    UFUNCTION()
+    double Sum8(int32 A, int32 B, float C, float D, double E, double F, bool G, int32 H)
+    {
+        return A + B + C + D + E + F + (G ? 1 : 0) + H;
+    }
+
+    UFUNCTION()
+    double Mix8(int32 A, float B, const FString& C, const FVector& D, bool E, const TArray<int32>& F, FName G, double H)
+    {
+        double Sum = A + B + C.Len() + D.X + D.Y + D.Z + (E ? 1 : 0) + G.ToString().Len() + H;
+        for (int32 Value : F)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    }
+
+    UFUNCTION()
+    void Accumulate8(int32 A, float B, const FString& C, const FVector& D, bool E, const TArray<int32>& F, FName G,
+        int32& OutTotal)
+    {
+        OutTotal += A + static_cast<int32>(B) + C.Len() + static_cast<int32>(D.X) + (E ? 1 : 0) + F.Num() + G.ToString().Len();
+    }
+};
+
+// runs PuertsEditor/FrameBenchmark.js, which checks the results of every signature and then logs the time of a call loop
+// for each. fails if any result is wrong. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsFrameBenchmark -Iterations=1000000
+UCLASS()
+class UPuertsFrameBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,103 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsObjectChurnBenchmark.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "UObject/UObjectGlobals.h"
+
+int32 UPuertsObjectChurnBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 NumActors = 100000;
+    int32 PerFrame = 1000;
+    int32 GCInterval = 10;
+    FParse::Value(*Params, TEXT("Actors="), NumActors);
+    FParse::Value(*Params, TEXT("PerFrame="), PerFrame);
+    FParse::Value(*Params, TEXT("GCInterval="), GCInterval);
+    PerFrame = FMath::Max(PerFrame, 1);
+    GCInterval = FMath::Max(GCInterval, 1);
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+
+    UPuertsObjectChurnBenchmarkBridge* Bridge = NewObject<UPuertsObjectChurnBenchmarkBridge>();
+    Bridge->AddToRoot();
+
+    UE_LOG(LogPuertsBenchmark, Display, TEXT("churning %d actors, %d per frame, gc every %d frames, without js"), NumActors, PerFrame,
+        GCInterval);
+    RunPhase(World, Bridge, NumActors, PerFrame, GCInterval);
+
+    {
+        TUniquePtr<PUERTS_NAMESPACE::FJsEnv> JsEnv =
+            StartBenchmarkScript(TEXT("PuertsEditor/ObjectChurnBenchmark"), TEXT("Bridge"), Bridge);
+
+        UE_LOG(LogPuertsBenchmark, Display, TEXT("churning %d actors, %d per frame, gc every %d frames, with js references"),
+            NumActors, PerFrame, GCInterval);
+        RunPhase(World, Bridge, NumActors, PerFrame, GCInterval);
+
+        Bridge->OnActorsSpawned.Clear();
+    }
+
+    Bridge->RemoveFromRoot();
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    return 0;
+}
+
+void UPuertsObjectChurnBenchmarkCommandlet::RunPhase(
+    UWorld* World, UPuertsObjectChurnBenchmarkBridge* Bridge, int32 NumActors, int32 PerFrame, int32 GCInterval)
+{
+    TArray<AActor*> Batch;
+    Batch.Reserve(PerFrame);
+
+    double FrameTime = 0;
+    double GCTime = 0;
+    int32 Frames = 0;
+    for (int32 Spawned = 0; Spawned < NumActors; Spawned += PerFrame)
+    {
+        const double FrameStart = FPlatformTime::Seconds();
+
+        const int32 Count = FMath::Min(PerFrame, NumActors - Spawned);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Batch.Add(World->SpawnActor<AActor>());
+        }
+
+        Bridge->OnActorsSpawned.Broadcast(Batch);
+
+        for (AActor* Actor : Batch)
+        {
+            Actor->Destroy();
+        }
+        Batch.Reset();
+
+        ++Frames;
+        if (Frames % GCInterval == 0)
+        {
+            const double GCStart = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            GCTime += FPlatformTime::Seconds() - GCStart;
+        }
+
+        FrameTime += FPlatformTime::Seconds() - FrameStart;
+    }
+
+    const double GCStart = FPlatformTime::Seconds();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    GCTime += FPlatformTime::Seconds() - GCStart;
+
+    UE_LOG(LogPuertsBenchmark, Display, TEXT("%d frames, avg frame %.3f ms, total gc %.3f ms"), Frames,
+        Frames > 0 ? FrameTime * 1000.0 / Frames : 0.0, GCTime * 1000.0);
+}
@@ -0,0 +1,43 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsObjectChurnBenchmark.generated.h"
+
+class AActor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPuertsActorsSpawned, const TArray<AActor*>&, Actors);
+
+// handed to the benchmark script, which binds to the delegate and touches every actor so they get a js wrapper
+UCLASS()
+class UPuertsObjectChurnBenchmarkBridge : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FPuertsActorsSpawned OnActorsSpawned;
+};
+
+// spawns and destroys actors in batches, with and without js touching them, and reports the average frame and gc time.
+// the difference between both phases is the cost js adds to object churn, run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsObjectChurnBenchmark -Actors=100000 -PerFrame=1000 -GCInterval=10
+UCLASS()
+class UPuertsObjectChurnBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    void RunPhase(UWorld* World, UPuertsObjectChurnBenchmarkBridge* Bridge, int32 NumActors, int32 PerFrame, int32 GCInterval);
+};
@@ -0,0 +1,26 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsStringBenchmark.h"
+#include "Misc/Parse.h"
+
+int32 UPuertsStringBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Iterations = 1000000;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+    UPuertsStringBenchmarkTarget* Target = NewObject<UPuertsStringBenchmarkTarget>();
+    Target->AddToRoot();
+    Target->Iterations = FMath::Max(Iterations, 1);
+
+    // the script runs every workload from its top level and logs the results
+    RunBenchmarkScript(TEXT("PuertsEditor/StringBenchmark"), TEXT("Target"), Target);
+
+    Target->RemoveFromRoot();
+    return 0;
+}
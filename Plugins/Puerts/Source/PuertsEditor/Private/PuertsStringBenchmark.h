@@ -0,0 +1,65 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsStringBenchmark.generated.h"
+
+// called from the benchmark script, every call marshals one name or string through the reflection path
+UCLASS()
+class UPuertsStringBenchmarkTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+
+    UFUNCTION()
+    void SetNameValue(FName InName)
+    {
+        NameValue = InName;
+    }
+
+    UFUNCTION()
+    FName GetNameValue() const
+    {
+        return NameValue;
+    }
+
+    UFUNCTION()
+    void SetStringValue(const FString& InString)
+    {
+        StringValue = InString;
+    }
+
+    UFUNCTION()
+    FString GetStringValue() const
+    {
+        return StringValue;
+    }
+
+private:
+    FName NameValue;
+
+    FString StringValue;
+};
+
+// runs PuertsEditor/StringBenchmark.js, which logs the time of typical (a few dozen repeated names, short ascii strings) and worst
+// case (more distinct names than the cache holds, long and non latin-1 strings) marshalling workloads. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsStringBenchmark -Iterations=1000000
+UCLASS()
+class UPuertsStringBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,47 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#include "PuertsTimerBenchmark.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "UECompatible.h"
+
+int32 UPuertsTimerBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 NumTimers = 10000;
+    int32 Frames = 600;
+    FParse::Value(*Params, TEXT("Timers="), NumTimers);
+    FParse::Value(*Params, TEXT("Frames="), Frames);
+    Frames = FMath::Max(Frames, 1);
+
+    UPuertsTimerBenchmarkArgs* Args = NewObject<UPuertsTimerBenchmarkArgs>();
+    Args->AddToRoot();
+    Args->NumTimers = NumTimers;
+
+    TUniquePtr<PUERTS_NAMESPACE::FJsEnv> JsEnv = StartBenchmarkScript(TEXT("PuertsEditor/TimerBenchmark"), TEXT("Args"), Args);
+
+    // fixed 60 fps steps, so every run sees the exact same sequence of expirations
+    const float DeltaTime = 1.0f / 60.0f;
+    double TotalTime = 0;
+    double WorstTime = 0;
+    for (int32 Frame = 0; Frame < Frames; ++Frame)
+    {
+        const double Start = FPlatformTime::Seconds();
+        FUETicker::GetCoreTicker().Tick(DeltaTime);
+        const double Elapsed = FPlatformTime::Seconds() - Start;
+        TotalTime += Elapsed;
+        WorstTime = FMath::Max(WorstTime, Elapsed);
+    }
+
+    UE_LOG(LogPuertsBenchmark, Display, TEXT("%d timers, %d frames, %d callbacks, avg frame %.3f ms, worst frame %.3f ms"),
+        NumTimers, Frames, Args->NumFired, TotalTime * 1000.0 / Frames, WorstTime * 1000.0);
+
+    Args->RemoveFromRoot();
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsTimerBenchmark.generated.h"
+
+// handed to the benchmark script, which reads how many timers to create and counts the callbacks it got
+UCLASS()
+class UPuertsTimerBenchmarkArgs : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 NumTimers = 0;
+
+    UPROPERTY()
+    int32 NumFired = 0;
+};
+
+// keeps 10k js timers alive (self re-arming timeouts and intervals with deterministic delays) and reports the average cost of a
+// core ticker frame. run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsTimerBenchmark -Timers=10000 -Frames=600
+UCLASS()
+class UPuertsTimerBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,36 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 Tencent.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsBenchmarkCommandlet.h"
+#include "PuertsVectorBenchmark.generated.h"
+
+UCLASS()
+class UPuertsVectorBenchmarkArgs : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 Iterations = 0;
+};
+
+// runs PuertsEditor/VectorBenchmark.js, which logs the time of vector, rotator and transform math done from js, every op creating
+// a new struct instance. the struct pool counters of `stat Puerts` show the allocations when the same script runs in a game.
+// run it with:
+// UnrealEditor-Cmd <Project> -run=PuertsVectorBenchmark -Iterations=1000000
+UCLASS()
+class UPuertsVectorBenchmarkCommandlet : public UPuertsBenchmarkCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString& Params) override;
+};
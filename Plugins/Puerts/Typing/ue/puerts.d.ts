@@ -33,6 +33,8 @@ declare module "ue" {
         Set(Index: number, Value: T): void;
     }
     
+    type TypedArray = Int8Array | Uint8Array | Int16Array | Uint16Array | Int32Array | Uint32Array | BigInt64Array | BigUint64Array | Float32Array | Float64Array;
+    
     interface TArray<T> {
         [index: number]: never;
         Num(): number;
@@ -45,6 +47,9 @@ declare module "ue" {
         RemoveAt(Index: number): void;
         IsValidIndex(Index: number): boolean;
         Empty(): void;
+        ToTypedArray(): TypedArray;                 // 仅限数值或者同类型数值组成的POD结构体（如FVector），拷贝
+        FromTypedArray(Values: TypedArray): void;   // 用类型数组的内容替换整个数组
+        GetTypedArrayView(): TypedArray;            // 直接引用数组内存，仅限js创建的数组，数组长度变化后旧的视图会被detach
         [Symbol.iterator](): IterableIterator<T>;
     }
     
@@ -60,6 +65,7 @@ declare module "ue" {
         GetMaxIndex(): number;  // TODO - GetMaxIndex的返回值是InvalidIndex，合理吗？（GetMaxIndex的解释应该是：最大合法index+1），当调用Empty，返回值为0
         IsValidIndex(Index: number): boolean;
         Empty(): void;
+        ToArray(): T[];
         [Symbol.iterator](): IterableIterator<T>;
     }
     
@@ -74,6 +80,7 @@ declare module "ue" {
         IsValidIndex(Index: number): boolean;
         GetKey(Index: number): TKey;            // TODO - 对于非法index，是否应该返回undefined
         Empty(): void;
+        ToArray(): [TKey, TValue][];
         [Symbol.iterator](): IterableIterator<[TKey, TValue]>;
     }
 
@@ -7,6 +7,7 @@
 #include "CurrsorPlayerState.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "PaperZDAnimInstance.h"
 #include "Blueprint/UserWidget.h"
 #include "Component/CurrsorActionComponent.h"
 #include "Currsor/System/CurrsorGameInstance.h"
@@ -65,6 +66,33 @@ void ACurrsorPlayerController::BeginPlay()
     PlayerActionComponent->Initialize(CurrsorPlayer, CurrsorPlayerState, this);
 
     PlayerStateComponent = GetPlayerState<ACurrsorPlayerState>();
+
+    // 绑定原生通知回调，动画蓝图中同名的自定义通知会直接调用这些函数
+    // 通过 Execute_ 调用接口，保留蓝图/TS 对 ICombatInterface 的重写；动画蓝图没有注册的通知不绑定，避免每次 BeginPlay 都报警告
+    if (UPaperZDAnimInstance* AnimInstance = CurrsorPlayer ? CurrsorPlayer->GetAnimInstance() : nullptr)
+    {
+        if (AnimInstance->GetAnimNotifyIndex(TEXT("AttackHitboxOn")) != INDEX_NONE)
+        {
+            AnimInstance->BindAnimNotify(TEXT("AttackHitboxOn"), FZDOnAnimNotifyNativeSignature::CreateWeakLambda(this, [this]()
+            {
+                ICombatInterface::Execute_AttackHitboxOn(this);
+            }));
+        }
+        if (AnimInstance->GetAnimNotifyIndex(TEXT("AttackHitboxOff")) != INDEX_NONE)
+        {
+            AnimInstance->BindAnimNotify(TEXT("AttackHitboxOff"), FZDOnAnimNotifyNativeSignature::CreateWeakLambda(this, [this]()
+            {
+                ICombatInterface::Execute_AttackHitboxOff(this);
+            }));
+        }
+        if (AnimInstance->GetAnimNotifyIndex(TEXT("AttackEnd")) != INDEX_NONE)
+        {
+            AnimInstance->BindAnimNotify(TEXT("AttackEnd"), FZDOnAnimNotifyNativeSignature::CreateWeakLambda(this, [this]()
+            {
+                ICombatInterface::Execute_AttackEnd(this);
+            }));
+        }
+    }
 }
 
 void ACurrsorPlayerController::Tick(float DeltaTime)